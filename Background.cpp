@@ -2,16 +2,125 @@
 #include <cmath>
 
 Background::Background(int w, int h)
-    : width(w), height(h), time(0.0f), pulse(0.0f) {}
+    : width(w), height(h), time(0.0f), pulse(0.0f),
+      cached(false), baking(false), animationPeriod(1.0f / 30.0f), lastAnimatedBake(0.0f),
+      baseLayer(nullptr), animatedLayer(nullptr), vignetteLayer(nullptr) {}
+
+Background::~Background() {
+    destroyLayers();
+}
 
 void Background::update(float dt, float intensity) {
     time += dt;
     pulse += dt * (1.0f + intensity * 2.5f);
 }
 
+void Background::setCached(bool enabled, float animationHz) {
+    cached = enabled;
+    animationPeriod = animationHz > 0.0f ? 1.0f / animationHz : 0.0f;
+    if (!cached) destroyLayers();
+}
+
+void Background::resize(int w, int h) {
+    if (w == width && h == height) return;
+    width = w;
+    height = h;
+    destroyLayers(); // Re-baked at the new size on the next render
+}
+
 void Background::render(SDL_Renderer* r) {
     if (width <= 0 || height <= 0) return;
 
+    if (cached && (baseLayer || createLayers(r))) {
+        if (time - lastAnimatedBake >= animationPeriod || time < lastAnimatedBake) {
+            bakeAnimated(r);
+        }
+
+        // Base is opaque and replaces the frame; the other layers only cover
+        // the pixels their primitives touched.
+        SDL_SetRenderDrawColor(r, 4, 6, 12, 255);
+        SDL_RenderClear(r); // Whole window, like drawBase (the copy only fills the viewport)
+        SDL_RenderCopy(r, baseLayer, nullptr, nullptr);
+        SDL_RenderCopy(r, animatedLayer, nullptr, nullptr);
+        drawPulses(r); // Six lines that move every frame: cheaper to draw than to cache
+        SDL_RenderCopy(r, vignetteLayer, nullptr, nullptr);
+        return;
+    }
+
+    drawBase(r);
+    drawAnimated(r);
+    drawPulses(r);
+    drawVignette(r);
+}
+
+// Immediate drawing uses the renderer's default (no) blending, so every
+// primitive overwrites what is under it. Baked layers record drawn pixels as
+// opaque and get composited with alpha blending, which gives the same image.
+Uint8 Background::layerAlpha(Uint8 alpha) const {
+    return baking ? 255 : alpha;
+}
+
+bool Background::createLayers(SDL_Renderer* r) {
+    if (!SDL_RenderTargetSupported(r)) {
+        cached = false;
+        return false;
+    }
+
+    baseLayer = SDL_CreateTexture(r, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    animatedLayer = SDL_CreateTexture(r, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    vignetteLayer = SDL_CreateTexture(r, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!baseLayer || !animatedLayer || !vignetteLayer) {
+        destroyLayers();
+        cached = false;
+        return false;
+    }
+
+    SDL_SetTextureBlendMode(baseLayer, SDL_BLENDMODE_NONE);
+    SDL_SetTextureBlendMode(animatedLayer, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureBlendMode(vignetteLayer, SDL_BLENDMODE_BLEND);
+
+    bake(r, baseLayer, &Background::drawBase);
+    bake(r, vignetteLayer, &Background::drawVignette);
+    bakeAnimated(r);
+    return true;
+}
+
+void Background::destroyLayers() {
+    if (baseLayer) SDL_DestroyTexture(baseLayer);
+    if (animatedLayer) SDL_DestroyTexture(animatedLayer);
+    if (vignetteLayer) SDL_DestroyTexture(vignetteLayer);
+    baseLayer = animatedLayer = vignetteLayer = nullptr;
+}
+
+void Background::bake(SDL_Renderer* r, SDL_Texture* target, void (Background::*draw)(SDL_Renderer*)) {
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(r);
+    SDL_BlendMode previousMode;
+    SDL_GetRenderDrawBlendMode(r, &previousMode);
+
+    SDL_SetRenderTarget(r, target); // Also resets the viewport to the whole texture
+    SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(r, 0, 0, 0, 0);
+    SDL_RenderClear(r);
+
+    baking = true;
+    (this->*draw)(r);
+    baking = false;
+
+    SDL_SetRenderTarget(r, previousTarget); // Restores the caller's (shaken) viewport
+    SDL_SetRenderDrawBlendMode(r, previousMode);
+}
+
+void Background::bakeAnimated(SDL_Renderer* r) {
+    bake(r, animatedLayer, &Background::drawAnimated);
+    lastAnimatedBake = time;
+}
+
+void Background::drawAnimated(SDL_Renderer* r) {
+    drawWaves(r);
+    drawCorridor(r);
+}
+
+void Background::drawBase(SDL_Renderer* r) {
     // ---------- FUNDO BASE ----------
     SDL_SetRenderDrawColor(r, 4, 6, 12, 255);
     SDL_RenderClear(r);
@@ -21,12 +130,14 @@ void Background::render(SDL_Renderer* r) {
         float fog = (float)y / height;
         Uint8 alpha = (Uint8)(fog * 60);
 
-        SDL_SetRenderDrawColor(r, 20, 30, 50, alpha);
+        SDL_SetRenderDrawColor(r, 20, 30, 50, layerAlpha(alpha));
         SDL_RenderDrawLine(r, 0, y, width, y);
     }
+}
 
+void Background::drawWaves(SDL_Renderer* r) {
     // ---------- ONDAS DE FUNDO ----------
-    SDL_SetRenderDrawColor(r, 40, 70, 120, 35);
+    SDL_SetRenderDrawColor(r, 40, 70, 120, layerAlpha(35));
 
     for (int x = 0; x < width; x += 4) {
         float wave =
@@ -41,9 +152,11 @@ void Background::render(SDL_Renderer* r) {
             height
         );
     }
+}
 
+void Background::drawCorridor(SDL_Renderer* r) {
     // ---------- CORREDOR REATIVO ----------
-    SDL_SetRenderDrawColor(r, 90, 140, 220, 55);
+    SDL_SetRenderDrawColor(r, 90, 140, 220, layerAlpha(55));
 
     for (int y = 0; y < height; y += 6) {
 
@@ -63,7 +176,9 @@ void Background::render(SDL_Renderer* r) {
             y
         );
     }
+}
 
+void Background::drawPulses(SDL_Renderer* r) {
     // ---------- PULSOS DE WAVE ----------
     SDL_SetRenderDrawColor(r, 120, 180, 255, 45);
 
@@ -72,11 +187,13 @@ void Background::render(SDL_Renderer* r) {
         while (py > height) py -= height;
         SDL_RenderDrawLine(r, 0, (int)py, width, (int)py);
     }
+}
 
+void Background::drawVignette(SDL_Renderer* r) {
     // Vignette
     for (int i = 0; i < 120; i += 4) {
         Uint8 alpha = (Uint8)(i * 1.5f);
-        SDL_SetRenderDrawColor(r, 0, 0, 0, alpha);
+        SDL_SetRenderDrawColor(r, 0, 0, 0, layerAlpha(alpha));
 
         SDL_Rect top    = {0, i, width, 4};
         SDL_Rect bottom = {0, height - i, width, 4};
@@ -88,4 +205,4 @@ void Background::render(SDL_Renderer* r) {
         SDL_RenderFillRect(r, &left);
         SDL_RenderFillRect(r, &right);
     }
-}
\ No newline at end of file
+}
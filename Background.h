@@ -4,12 +4,44 @@
 class Background {
 public:
     Background(int w, int h);
+    ~Background();
+
+    Background(const Background&) = delete; // Owns textures
+    Background& operator=(const Background&) = delete;
 
     void update(float dt, float intensity); // intensity = wave pressure
     void render(SDL_Renderer* r);
 
+    // Cached mode: fog and vignette are baked once into render-target
+    // textures, waves and corridor are re-baked at animationHz, and a frame
+    // is a few SDL_RenderCopy calls. Falls back to immediate drawing when
+    // the renderer has no render-target support.
+    void setCached(bool enabled, float animationHz = 30.0f);
+    void resize(int w, int h);
+
 private:
     int width, height;
     float time;
     float pulse;
-};
\ No newline at end of file
+
+    bool cached;
+    bool baking;           // Drawing into a cache texture right now
+    float animationPeriod; // Seconds between re-bakes of the animated layer
+    float lastAnimatedBake;
+    SDL_Texture* baseLayer;     // Clear color + fog (opaque)
+    SDL_Texture* animatedLayer; // Waves + corridor (transparent elsewhere)
+    SDL_Texture* vignetteLayer; // Edge darkening (transparent elsewhere)
+
+    void drawBase(SDL_Renderer* r);
+    void drawWaves(SDL_Renderer* r);
+    void drawCorridor(SDL_Renderer* r);
+    void drawAnimated(SDL_Renderer* r); // Waves + corridor
+    void drawPulses(SDL_Renderer* r);
+    void drawVignette(SDL_Renderer* r);
+
+    Uint8 layerAlpha(Uint8 alpha) const;
+    bool createLayers(SDL_Renderer* r);
+    void destroyLayers();
+    void bake(SDL_Renderer* r, SDL_Texture* target, void (Background::*draw)(SDL_Renderer*));
+    void bakeAnimated(SDL_Renderer* r);
+};
@@ -2,7 +2,6 @@
 #ifndef BULLET_H
 #define BULLET_H
 
-#include <SDL2/SDL.h> // Include SDL for SDL_Renderer
 #include <cmath> // For sinf, cosf
 
 // Bullet Types
@@ -14,6 +13,7 @@ enum BulletType {
 class Bullet {
 public:
     float x, y, vx, vy; // Changed from dx, dy to vx, vy
+    float prevX, prevY; // Position at the start of the last update (render interpolation)
     int damage;
     int pierce;
     bool isPlayerOwned;
@@ -28,7 +28,6 @@ public:
     Bullet(); // Default constructor
     Bullet(float px, float py, float pvx, float pvy, int pdamage, bool playerOwned); // Updated signature
     void update(float deltaTime);
-    void render(SDL_Renderer* r); // Added render method
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,199 @@
+// BulletStore.cpp
+#include "BulletStore.h"
+#include <algorithm> // For std::sort, std::unique
+#include <cmath>     // For sinf, cosf, atan2f
+#include <cstring>   // For memcpy
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+BulletStore::BulletStore(size_t pcapacity, bool pgrowable)
+    : count(0), cap(0), plasmaCount(0), growable(pgrowable)
+{
+    reserve(pcapacity > 0 ? pcapacity : 1);
+}
+
+void BulletStore::reserve(size_t pcapacity) {
+    cap = pcapacity;
+    x.resize(cap); y.resize(cap); vx.resize(cap); vy.resize(cap);
+    prevX.resize(cap); prevY.resize(cap);
+    speed.resize(cap); baseAngle.resize(cap); wavePhase.resize(cap);
+    damage.resize(cap); pierce.resize(cap);
+    type.resize(cap); flags.resize(cap);
+    destroyed.reserve(cap);
+    culled.reserve(cap);
+    counters.capacity = cap;
+}
+
+int BulletStore::spawn(float px, float py, float pvx, float pvy, int pdamage, int ppierce, int ptype, bool playerOwned) {
+    if (count >= cap) {
+        if (!growable) {
+            counters.misses++;
+            return -1;
+        }
+        reserve(cap * 2);
+        counters.growths++;
+    }
+
+    size_t i = count++;
+    if (count > counters.highWater) counters.highWater = count;
+    x[i] = prevX[i] = px;
+    y[i] = prevY[i] = py;
+    vx[i] = pvx;
+    vy[i] = pvy;
+    speed[i] = sqrtf(pvx * pvx + pvy * pvy);
+    baseAngle[i] = atan2f(pvy, pvx);
+    wavePhase[i] = 0.0f;
+    damage[i] = pdamage;
+    pierce[i] = ppierce;
+    type[i] = (uint8_t)ptype;
+    flags[i] = playerOwned ? FLAG_PLAYER_OWNED : 0;
+    if (ptype == BULLET_PLASMA) plasmaCount++;
+    return (int)i;
+}
+
+void BulletStore::markDestroyed(size_t i) {
+    if (flags[i] & FLAG_DESTROY) return;
+    flags[i] |= FLAG_DESTROY;
+    destroyed.push_back((uint32_t)i);
+}
+
+// Same steering as Bullet::update, applied only to plasma bullets.
+void BulletStore::steerPlasma(float deltaTime, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        if (type[i] != BULLET_PLASMA) continue;
+        float wave = sinf(wavePhase[i]) * 0.08f;
+        float angle = baseAngle[i] + wave;
+        vx[i] = cosf(angle) * speed[i];
+        vy[i] = sinf(angle) * speed[i];
+        wavePhase[i] += deltaTime * 8.0f;
+    }
+}
+
+void BulletStore::integrateAndCull(float deltaTime, float minX, float minY, float maxX, float maxY, JobSystem* jobs) {
+    // Bullets that left the bounds on the last call (collision still tested
+    // their way out) and bullets marked destroyed since (e.g. spent by it)
+    if (!destroyed.empty()) {
+        culled.insert(culled.end(), destroyed.begin(), destroyed.end());
+        destroyed.clear();
+        std::sort(culled.begin(), culled.end());
+        culled.erase(std::unique(culled.begin(), culled.end()), culled.end());
+    }
+
+    // Highest index first: the element swapped in from the back is always a survivor
+    for (size_t k = culled.size(); k-- > 0; ) {
+        removeAt(culled[k]);
+    }
+
+    size_t chunks = (count + CHUNK - 1) / CHUNK;
+    if (chunkCulled.size() < chunks) chunkCulled.resize(chunks);
+    JobSystem::forEachChunk(jobs, count, CHUNK, [&](size_t begin, size_t end, unsigned) {
+        std::vector<uint32_t>& out = chunkCulled[begin / CHUNK];
+        out.clear();
+        integrateRange(deltaTime, minX, minY, maxX, maxY, begin, end, out);
+    });
+
+    // Chunk order = index order, as if one thread had walked the whole range
+    culled.clear();
+    for (size_t c = 0; c < chunks; ++c) {
+        culled.insert(culled.end(), chunkCulled[c].begin(), chunkCulled[c].end());
+    }
+}
+
+// Moves [begin, end) and appends the indices that left the bounds to out.
+// begin is a multiple of 8, so the aligned SIMD loads stay aligned.
+void BulletStore::integrateRange(float deltaTime, float minX, float minY, float maxX, float maxY,
+                                 size_t begin, size_t end, std::vector<uint32_t>& out) {
+    if (plasmaCount > 0) steerPlasma(deltaTime, begin, end);
+
+    float* px = x.get();
+    float* py = y.get();
+    const float* pvx = vx.get();
+    const float* pvy = vy.get();
+
+    // Save previous positions (render interpolation) in one pass
+    memcpy(prevX.get() + begin, px + begin, (end - begin) * sizeof(float));
+    memcpy(prevY.get() + begin, py + begin, (end - begin) * sizeof(float));
+
+    size_t i = begin;
+#if defined(__AVX__)
+    const __m256 dt8 = _mm256_set1_ps(deltaTime);
+    const __m256 minX8 = _mm256_set1_ps(minX), maxX8 = _mm256_set1_ps(maxX);
+    const __m256 minY8 = _mm256_set1_ps(minY), maxY8 = _mm256_set1_ps(maxY);
+    for (; i + 8 <= end; i += 8) {
+        __m256 nx = _mm256_add_ps(_mm256_load_ps(px + i), _mm256_mul_ps(_mm256_load_ps(pvx + i), dt8));
+        __m256 ny = _mm256_add_ps(_mm256_load_ps(py + i), _mm256_mul_ps(_mm256_load_ps(pvy + i), dt8));
+        _mm256_store_ps(px + i, nx);
+        _mm256_store_ps(py + i, ny);
+
+        // Ordered compares: NaN positions count as outside and get culled
+        __m256 inside = _mm256_and_ps(
+            _mm256_and_ps(_mm256_cmp_ps(nx, minX8, _CMP_GE_OQ), _mm256_cmp_ps(nx, maxX8, _CMP_LE_OQ)),
+            _mm256_and_ps(_mm256_cmp_ps(ny, minY8, _CMP_GE_OQ), _mm256_cmp_ps(ny, maxY8, _CMP_LE_OQ)));
+        int outMask = ~_mm256_movemask_ps(inside) & 0xFF;
+        while (outMask) {
+            int lane = __builtin_ctz(outMask);
+            out.push_back((uint32_t)(i + lane));
+            outMask &= outMask - 1;
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128 dt4 = _mm_set1_ps(deltaTime);
+    const __m128 minX4 = _mm_set1_ps(minX), maxX4 = _mm_set1_ps(maxX);
+    const __m128 minY4 = _mm_set1_ps(minY), maxY4 = _mm_set1_ps(maxY);
+    for (; i + 4 <= end; i += 4) {
+        __m128 nx = _mm_add_ps(_mm_load_ps(px + i), _mm_mul_ps(_mm_load_ps(pvx + i), dt4));
+        __m128 ny = _mm_add_ps(_mm_load_ps(py + i), _mm_mul_ps(_mm_load_ps(pvy + i), dt4));
+        _mm_store_ps(px + i, nx);
+        _mm_store_ps(py + i, ny);
+
+        // Ordered compares: NaN positions count as outside and get culled
+        __m128 inside = _mm_and_ps(
+            _mm_and_ps(_mm_cmpge_ps(nx, minX4), _mm_cmple_ps(nx, maxX4)),
+            _mm_and_ps(_mm_cmpge_ps(ny, minY4), _mm_cmple_ps(ny, maxY4)));
+        int outMask = ~_mm_movemask_ps(inside) & 0xF;
+        while (outMask) {
+            int lane = __builtin_ctz(outMask);
+            out.push_back((uint32_t)(i + lane));
+            outMask &= outMask - 1;
+        }
+    }
+#endif
+    // Scalar tail (and the whole range without SIMD)
+    for (; i < end; ++i) {
+        px[i] += pvx[i] * deltaTime;
+        py[i] += pvy[i] * deltaTime;
+        bool inside = px[i] >= minX && px[i] <= maxX && py[i] >= minY && py[i] <= maxY;
+        if (!inside) out.push_back((uint32_t)i);
+    }
+}
+
+void BulletStore::removeAt(size_t i) {
+    if (i >= count) return;
+    if (type[i] == BULLET_PLASMA) plasmaCount--;
+
+    size_t last = --count;
+    if (i != last) {
+        x[i] = x[last]; y[i] = y[last];
+        vx[i] = vx[last]; vy[i] = vy[last];
+        prevX[i] = prevX[last]; prevY[i] = prevY[last];
+        speed[i] = speed[last]; baseAngle[i] = baseAngle[last]; wavePhase[i] = wavePhase[last];
+        damage[i] = damage[last]; pierce[i] = pierce[last];
+        type[i] = type[last]; flags[i] = flags[last];
+    }
+}
+
+void BulletStore::clear() {
+    count = 0;
+    plasmaCount = 0;
+    destroyed.clear();
+    culled.clear();
+}
+
+void BulletStore::snapPrevious() {
+    memcpy(prevX.get(), x.get(), count * sizeof(float));
+    memcpy(prevY.get(), y.get(), count * sizeof(float));
+}
@@ -0,0 +1,108 @@
+// BulletStore.h
+#ifndef BULLETSTORE_H
+#define BULLETSTORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Bullet.h" // BulletType
+#include "ObjectPool.h" // PoolStats
+#include "JobSystem.h"
+
+// Fixed-capacity array with storage aligned for 256-bit SIMD loads.
+template <typename T>
+class AlignedArray {
+public:
+    static const size_t ALIGNMENT = 32;
+
+    AlignedArray() : data(nullptr), count(0) {}
+
+    void resize(size_t pcount) {
+        // Over-allocate and round the start up; element count is padded to a
+        // full 8-lane block so SIMD kernels may read past size() safely.
+        size_t padded = (pcount + 7) & ~(size_t)7;
+        std::unique_ptr<unsigned char[]> fresh(new unsigned char[padded * sizeof(T) + ALIGNMENT]());
+        uintptr_t addr = reinterpret_cast<uintptr_t>(fresh.get());
+        T* aligned = reinterpret_cast<T*>((addr + ALIGNMENT - 1) & ~(uintptr_t)(ALIGNMENT - 1));
+        for (size_t i = 0; i < count && i < pcount; ++i) aligned[i] = data[i];
+        raw = std::move(fresh);
+        data = aligned;
+        count = pcount;
+    }
+
+    T& operator[](size_t i) { return data[i]; }
+    const T& operator[](size_t i) const { return data[i]; }
+    T* get() { return data; }
+    const T* get() const { return data; }
+
+private:
+    std::unique_ptr<unsigned char[]> raw;
+    T* data;
+    size_t count;
+};
+
+// Structure-of-arrays bullet container. Live bullets occupy [0, size()) in
+// every array; removal is swap-with-last so the range stays dense.
+class BulletStore {
+public:
+    enum Flags : uint8_t {
+        FLAG_PLAYER_OWNED = 1 << 0,
+        FLAG_DESTROY = 1 << 1 // Deferred destruction: culled by the next integrateAndCull
+    };
+
+    AlignedArray<float> x, y, vx, vy;
+    AlignedArray<float> prevX, prevY; // Position before the last integration (render interpolation)
+    AlignedArray<float> speed, baseAngle, wavePhase; // Plasma steering
+    AlignedArray<int> damage, pierce;
+    AlignedArray<uint8_t> type;  // BulletType
+    AlignedArray<uint8_t> flags; // Flags
+
+    // pgrowable: when full, double the arrays instead of dropping the bullet.
+    // Bullets are addressed by index, so reallocating is safe between ticks.
+    explicit BulletStore(size_t pcapacity, bool pgrowable = false);
+
+    size_t size() const { return count; }
+    size_t capacity() const { return cap; }
+    bool empty() const { return count == 0; }
+    void setGrowable(bool pgrowable) { growable = pgrowable; }
+    const PoolStats& stats() const { return counters; }
+
+    // Returns the new bullet's index, or -1 when the store is full (and fixed).
+    int spawn(float px, float py, float pvx, float pvy, int pdamage, int ppierce, int ptype, bool playerOwned);
+
+    void markDestroyed(size_t i);
+    bool isDestroyed(size_t i) const { return (flags[i] & FLAG_DESTROY) != 0; }
+    bool isPlayerOwned(size_t i) const { return (flags[i] & FLAG_PLAYER_OWNED) != 0; }
+
+    // Removes bullets marked destroyed and bullets the last call left outside
+    // [minX,maxX]x[minY,maxY], then moves every bullet by its velocity. A
+    // bullet leaving the bounds thus stays one tick, so collision still tests
+    // its last segment. Vectorized with AVX or SSE when the compiler targets
+    // them, scalar otherwise. With jobs, chunks of CHUNK bullets move in
+    // parallel; the result is the same.
+    void integrateAndCull(float deltaTime, float minX, float minY, float maxX, float maxY,
+                          JobSystem* jobs = nullptr);
+    static const size_t CHUNK = 4096; // Multiple of 8: chunks start on aligned SIMD blocks
+
+    void clear();
+    void snapPrevious(); // prevX/prevY = x/y
+
+private:
+    size_t count;
+    size_t cap;
+    size_t plasmaCount; // Plasma needs per-bullet trig; skip that pass when zero
+    bool growable;
+    PoolStats counters;
+    std::vector<uint32_t> destroyed; // Indices marked since the last cull
+    std::vector<uint32_t> culled;    // Indices out of bounds, removed by the next cull
+    std::vector<std::vector<uint32_t>> chunkCulled; // Scratch: out-of-bounds indices per chunk
+
+    void steerPlasma(float deltaTime, size_t begin, size_t end);
+    void integrateRange(float deltaTime, float minX, float minY, float maxX, float maxY,
+                        size_t begin, size_t end, std::vector<uint32_t>& out);
+    void reserve(size_t pcapacity);
+    void removeAt(size_t i); // Only from the cull: pending destroy indices must stay valid
+};
+
+#endif
@@ -1,7 +1,19 @@
 // DamageEvent.h
 #pragma once
+#include <cstdint>
+#include "ObjectPool.h"
 
+// One bullet hitting one enemy. Collision detection fills in who, where and
+// t; GameState's resolution stage rolls the damage and sets the outcome.
+// Enemy::takeDamage fills amount and critical.
 struct DamageEvent {
     int amount;
     bool critical;
-};
\ No newline at end of file
+    bool killed;     // Enemy at 0 hp after this hit
+    bool executed;   // Finished by the Execute upgrade: no roll, no number
+    uint32_t bullet; // Slot in GameState::bullets
+    PoolHandle enemy;
+    uint32_t enemySerial; // Enemy::serial: breaks ties in t independently of pool slots
+    float x, y;      // Enemy position at the hit
+    float t;         // Along the bullet's move, 0..1
+};
@@ -0,0 +1,71 @@
+// DamageNumbers.cpp
+#include "DamageNumbers.h"
+
+static const size_t RECENT_SLOTS = 64; // Power of two
+
+DamageNumberBuffer::DamageNumberBuffer(size_t pcapacity)
+    : entries(pcapacity > 0 ? pcapacity : 1), head(0), count(0), nextSeq(0), coalesceWindow(0.0f),
+      recent(RECENT_SLOTS, Recent{PoolHandle::invalid(), 0}) {}
+
+DamageNumber* DamageNumberBuffer::findRecent(PoolHandle owner) {
+    const Recent& r = recent[owner.index & (RECENT_SLOTS - 1)];
+    if (r.owner != owner) return nullptr;
+
+    uint64_t oldestSeq = nextSeq - count;
+    if (r.seq < oldestSeq) return nullptr; // Already expired or overwritten
+
+    DamageNumber& dn = entries[r.seq % entries.size()];
+    return dn.age < coalesceWindow ? &dn : nullptr;
+}
+
+void DamageNumberBuffer::add(float x, float y, int value, bool critical, PoolHandle owner) {
+    if (coalesceWindow > 0.0f && owner.isValid()) {
+        DamageNumber* dn = findRecent(owner);
+        if (dn) {
+            // Life is not refreshed, so expiry order stays oldest-first
+            dn->value += value;
+            dn->critical = dn->critical || critical;
+            return;
+        }
+    }
+
+    if (count == entries.size()) { // Full: drop the oldest
+        head = (head + 1) % entries.size();
+        count--;
+    }
+
+    DamageNumber& dn = entries[nextSeq % entries.size()];
+    dn.x = x;
+    dn.y = y;
+    dn.value = value;
+    dn.critical = critical;
+    dn.life = LIFETIME;
+    dn.age = 0.0f;
+    dn.owner = owner;
+    count++;
+
+    if (owner.isValid()) recent[owner.index & (RECENT_SLOTS - 1)] = Recent{owner, nextSeq};
+    nextSeq++;
+}
+
+void DamageNumberBuffer::update(float deltaTime) {
+    size_t cap = entries.size();
+    for (size_t i = 0; i < count; ++i) {
+        DamageNumber& dn = entries[(head + i) % cap];
+        dn.y -= deltaTime * 40.0f; // Float upwards
+        dn.life -= deltaTime;      // Decay life
+        dn.age += deltaTime;
+    }
+    // Same lifetime for all: expired numbers are always at the tail
+    while (count > 0 && entries[head].life <= 0) {
+        head = (head + 1) % cap;
+        count--;
+    }
+}
+
+void DamageNumberBuffer::clear() {
+    head = 0;
+    count = 0;
+    nextSeq = 0;
+    for (Recent& r : recent) r = Recent{PoolHandle::invalid(), 0};
+}
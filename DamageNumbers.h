@@ -0,0 +1,58 @@
+// DamageNumbers.h
+#ifndef DAMAGENUMBERS_H
+#define DAMAGENUMBERS_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "ObjectPool.h" // PoolHandle
+
+struct DamageNumber {
+    float x, y;
+    int value;
+    float life;
+    bool critical;
+    float age;         // Seconds since spawned (coalescing window)
+    PoolHandle owner;  // Enemy that was hit
+};
+
+// Fixed-capacity ring of floating damage numbers. Every number lives the same
+// time and they are pushed in time order, so the oldest always expires first:
+// insert and expire are O(1) and memory never grows. When full, the oldest
+// number is overwritten.
+//
+// Optional coalescing: a hit on the same enemy within coalesceWindow seconds
+// of that enemy's latest number adds into it instead of spawning a new one.
+class DamageNumberBuffer {
+public:
+    static constexpr float LIFETIME = 0.8f; // Damage number life in seconds
+
+    explicit DamageNumberBuffer(size_t pcapacity);
+
+    void setCoalesceWindow(float seconds) { coalesceWindow = seconds; } // 0 disables
+    float getCoalesceWindow() const { return coalesceWindow; }
+
+    void add(float x, float y, int value, bool critical, PoolHandle owner);
+    void update(float deltaTime); // Float upwards, age, expire from the tail
+    void clear();
+
+    size_t size() const { return count; }
+    size_t capacity() const { return entries.size(); }
+    // i = 0 is the oldest live number
+    const DamageNumber& operator[](size_t i) const { return entries[(head + i) % entries.size()]; }
+
+private:
+    std::vector<DamageNumber> entries;
+    size_t head;  // Oldest live entry
+    size_t count;
+    uint64_t nextSeq; // Sequence number of the next push (entry = seq % capacity)
+    float coalesceWindow;
+
+    // Direct-mapped: enemy slot -> sequence number of its latest number
+    struct Recent { PoolHandle owner; uint64_t seq; };
+    std::vector<Recent> recent;
+
+    DamageNumber* findRecent(PoolHandle owner);
+};
+
+#endif
@@ -0,0 +1,182 @@
+// DigitAtlas.cpp
+#include "DigitAtlas.h"
+#include <cmath> // For ceilf
+
+// Smallest baked scale >= the requested one is drawn scaled down
+const float DigitAtlas::SCALES[DigitAtlas::SCALE_COUNT] = {1.0f, 1.6f, 2.0f};
+
+// Segment definitions for a 7-segment display
+//   ---0---
+//  |       |
+//  5       1
+//  |       |
+//   ---6---
+//  |       |
+//  4       2
+//  |       |
+//   ---3---
+static const bool DIGIT_SEGMENTS[10][7] = {
+    {true,  true,  true,  true,  true,  true,  false}, // 0
+    {false, true,  true,  false, false, false, false}, // 1
+    {true,  true,  false, true,  true,  false, true }, // 2
+    {true,  true,  true,  true,  false, false, true }, // 3
+    {false, true,  true,  false, false, true,  true }, // 4
+    {true,  false, true,  true,  false, true,  true }, // 5
+    {true,  false, true,  true,  true,  true,  true }, // 6
+    {true,  true,  true,  false, false, false, false}, // 7
+    {true,  true,  true,  true,  true,  true,  true }, // 8
+    {true,  true,  true,  true,  false, true,  true }, // 9
+};
+
+DigitAtlas::DigitAtlas() : texture(nullptr), attempted(false), atlasWidth(0), atlasHeight(0) {}
+
+DigitAtlas::~DigitAtlas() {
+    if (texture) SDL_DestroyTexture(texture);
+}
+
+int DigitAtlas::segmentRects(int digit, int x_pos, int y_pos, float digit_scale, SDL_Rect out[7]) {
+    if (digit < 0 || digit > 9) return 0;
+    const bool* segments = DIGIT_SEGMENTS[digit];
+
+    float seg_w = 2.0f * digit_scale; // Thickness of segments
+    float seg_h = 2.0f * digit_scale;
+    float seg_len = 6.0f * digit_scale; // Length of horizontal segments
+    float vert_len = 6.0f * digit_scale; // Length of vertical segments
+
+    int n = 0;
+    // Segment 0 (top)
+    if (segments[0]) out[n++] = SDL_Rect{(int)(x_pos), (int)(y_pos), (int)seg_len, (int)seg_h};
+    // Segment 1 (top-right)
+    if (segments[1]) out[n++] = SDL_Rect{(int)(x_pos + seg_len - seg_w), (int)(y_pos), (int)seg_w, (int)vert_len};
+    // Segment 2 (bottom-right)
+    if (segments[2]) out[n++] = SDL_Rect{(int)(x_pos + seg_len - seg_w), (int)(y_pos + vert_len + seg_h), (int)seg_w, (int)vert_len};
+    // Segment 3 (bottom)
+    if (segments[3]) out[n++] = SDL_Rect{(int)(x_pos), (int)(y_pos + 2 * vert_len + seg_h), (int)seg_len, (int)seg_h};
+    // Segment 4 (bottom-left)
+    if (segments[4]) out[n++] = SDL_Rect{(int)(x_pos), (int)(y_pos + vert_len + seg_h), (int)seg_w, (int)vert_len};
+    // Segment 5 (top-left)
+    if (segments[5]) out[n++] = SDL_Rect{(int)(x_pos), (int)(y_pos), (int)seg_w, (int)vert_len};
+    // Segment 6 (middle)
+    if (segments[6]) out[n++] = SDL_Rect{(int)(x_pos), (int)(y_pos + vert_len), (int)seg_len, (int)seg_h};
+    return n;
+}
+
+int DigitAtlas::digitsOf(int value, int out[10]) {
+    if (value <= 0) { // Handle zero case (damage is never negative)
+        out[0] = 0;
+        return 1;
+    }
+    int reversed[10];
+    int n = 0;
+    while (value > 0 && n < 10) {
+        reversed[n++] = value % 10;
+        value /= 10;
+    }
+    for (int i = 0; i < n; ++i) out[i] = reversed[n - 1 - i];
+    return n;
+}
+
+bool DigitAtlas::build(SDL_Renderer* renderer) {
+    if (texture || attempted) return texture != nullptr;
+    attempted = true;
+    if (!SDL_RenderTargetSupported(renderer)) return false;
+
+    // One row per scale, ten cells per row, 1px gutter against filtering bleed
+    int rowY[SCALE_COUNT];
+    atlasWidth = 0;
+    atlasHeight = 0;
+    for (int s = 0; s < SCALE_COUNT; ++s) {
+        int cellW = (int)ceilf(GLYPH_WIDTH * SCALES[s]) + 2;
+        int cellH = (int)ceilf(GLYPH_HEIGHT * SCALES[s]) + 2;
+        rowY[s] = atlasHeight;
+        atlasHeight += cellH;
+        if (cellW * 10 > atlasWidth) atlasWidth = cellW * 10;
+        for (int d = 0; d < 10; ++d) {
+            glyphs[s][d] = SDL_Rect{d * cellW + 1, rowY[s] + 1, cellW - 2, cellH - 2};
+        }
+    }
+
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, atlasWidth, atlasHeight);
+    if (!texture) return false;
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    SDL_BlendMode previousMode;
+    SDL_GetRenderDrawBlendMode(renderer, &previousMode);
+
+    SDL_SetRenderTarget(renderer, texture);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 0);
+    SDL_RenderClear(renderer);
+
+    // White glyphs: tint and fade come from color/alpha modulation at draw time
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    for (int s = 0; s < SCALE_COUNT; ++s) {
+        for (int d = 0; d < 10; ++d) {
+            SDL_Rect rects[7];
+            int n = segmentRects(d, glyphs[s][d].x, glyphs[s][d].y, SCALES[s], rects);
+            SDL_RenderFillRects(renderer, rects, n);
+        }
+    }
+
+    SDL_SetRenderTarget(renderer, previousTarget);
+    SDL_SetRenderDrawBlendMode(renderer, previousMode);
+    return true;
+}
+
+int DigitAtlas::pickScale(float scale) const {
+    for (int s = 0; s < SCALE_COUNT; ++s) {
+        if (SCALES[s] >= scale) return s;
+    }
+    return SCALE_COUNT - 1;
+}
+
+void DigitAtlas::queueNumber(int value, float x, float y, float scale, SDL_Color color) {
+    if (!texture) return;
+
+    int digits[10];
+    int count = digitsOf(value, digits);
+    int s = pickScale(scale);
+    float ratio = scale / SCALES[s];
+    int advance = (int)(GLYPH_ADVANCE * scale); // Advance X for next digit
+
+    float penX = x;
+    for (int i = 0; i < count; ++i) {
+        const SDL_Rect& src = glyphs[s][digits[i]];
+        float w = src.w * ratio;
+        float h = src.h * ratio;
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+        float u0 = (float)src.x / atlasWidth, v0 = (float)src.y / atlasHeight;
+        float u1 = (float)(src.x + src.w) / atlasWidth, v1 = (float)(src.y + src.h) / atlasHeight;
+        int base = (int)vertices.size();
+        vertices.push_back(SDL_Vertex{{penX, y}, color, {u0, v0}});
+        vertices.push_back(SDL_Vertex{{penX + w, y}, color, {u1, v0}});
+        vertices.push_back(SDL_Vertex{{penX + w, y + h}, color, {u1, v1}});
+        vertices.push_back(SDL_Vertex{{penX, y + h}, color, {u0, v1}});
+        const int quad[6] = {0, 1, 2, 0, 2, 3};
+        for (int q : quad) indices.push_back(base + q);
+#else
+        quads.push_back(Quad{src, SDL_Rect{(int)penX, (int)y, (int)(w + 0.5f), (int)(h + 0.5f)}, color});
+#endif
+        penX += advance;
+    }
+}
+
+void DigitAtlas::flush(SDL_Renderer* renderer) {
+    if (!texture) return;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (!indices.empty()) {
+        SDL_RenderGeometry(renderer, texture, vertices.data(), (int)vertices.size(), indices.data(), (int)indices.size());
+    }
+    vertices.clear();
+    indices.clear();
+#else
+    for (const Quad& q : quads) {
+        SDL_SetTextureColorMod(texture, q.color.r, q.color.g, q.color.b);
+        SDL_SetTextureAlphaMod(texture, q.color.a);
+        SDL_RenderCopy(renderer, texture, &q.src, &q.dst);
+    }
+    quads.clear();
+#endif
+}
@@ -0,0 +1,61 @@
+// DigitAtlas.h
+#ifndef DIGITATLAS_H
+#define DIGITATLAS_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+// 7-segment digits 0-9 pre-rasterized once into a white texture at a few
+// scales. Numbers are queued as textured quads straight from the integer
+// (no string formatting), tinted through per-quad color/alpha modulation,
+// and submitted in one SDL_RenderGeometry call per flush (SDL 2.0.18+;
+// older headers fall back to one SDL_RenderCopy per digit).
+class DigitAtlas {
+public:
+    // Glyph metrics at scale 1.0, in pixels (matches the old rect renderer)
+    static const int GLYPH_WIDTH = 6;
+    static const int GLYPH_HEIGHT = 16;
+    static const int GLYPH_ADVANCE = 8;
+
+    DigitAtlas();
+    ~DigitAtlas();
+    DigitAtlas(const DigitAtlas&) = delete;
+    DigitAtlas& operator=(const DigitAtlas&) = delete;
+
+    // Builds the texture (needs render-target support). Safe to call every
+    // frame: does nothing once built or after a failed attempt.
+    bool build(SDL_Renderer* renderer);
+    bool isReady() const { return texture != nullptr; }
+
+    // Queues value (>= 0) with its top-left corner at (x, y).
+    void queueNumber(int value, float x, float y, float scale, SDL_Color color);
+    void flush(SDL_Renderer* renderer);
+
+    // Segment rects of one digit at (x, y): the shared source of truth for
+    // baking and for drawing digits as plain rects. Returns the rect count.
+    static int segmentRects(int digit, int x, int y, float scale, SDL_Rect out[7]);
+
+    // Splits value into decimal digits, most significant first. Returns count.
+    static int digitsOf(int value, int out[10]);
+
+private:
+    static const int SCALE_COUNT = 3;
+    static const float SCALES[SCALE_COUNT];
+
+    SDL_Texture* texture;
+    bool attempted;
+    int atlasWidth, atlasHeight;
+    SDL_Rect glyphs[SCALE_COUNT][10]; // Source rect per baked scale and digit
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+#else
+    struct Quad { SDL_Rect src; SDL_Rect dst; SDL_Color color; };
+    std::vector<Quad> quads;
+#endif
+
+    int pickScale(float scale) const;
+};
+
+#endif
@@ -0,0 +1,67 @@
+// Emitter.cpp
+#include "Emitter.h"
+#include <cmath>   // For sinf, cosf, atan2f
+#include <cstring> // For strcmp
+#include "Bullet.h"
+#include "BulletStore.h"
+
+static const float TWO_PI = 6.2831853f;
+static const float DOWN = 1.5707963f; // +y is down the screen
+
+static const EmitterPattern PATTERNS[EMITTER_COUNT] = {
+    // kind             count  type           dmg  interval speed   step
+    { EMIT_RADIAL,      0,     BULLET_LASER,  0,   1.0f,    0.0f,   0.0f },  // EMITTER_NONE
+    { EMIT_AIMED_FAN,   3,     BULLET_SPREAD, 8,   1.6f,    220.0f, 0.25f }, // EMITTER_AIMED_FAN
+    { EMIT_RADIAL,      12,    BULLET_SPREAD, 6,   2.2f,    160.0f, 0.0f },  // EMITTER_RADIAL
+    { EMIT_SPIRAL,      4,     BULLET_SPREAD, 5,   0.12f,   150.0f, 0.2f },  // EMITTER_SPIRAL
+    { EMIT_PLASMA_WAVE, 7,     BULLET_PLASMA, 10,  1.4f,    140.0f, 0.18f }, // EMITTER_PLASMA_WAVE
+};
+
+static const char* const NAMES[EMITTER_COUNT] = { "none", "fan", "radial", "spiral", "plasma" };
+
+const EmitterPattern& emitterPattern(int id) {
+    return PATTERNS[(id > 0 && id < EMITTER_COUNT) ? id : EMITTER_NONE];
+}
+
+const char* emitterName(int id) {
+    return NAMES[(id > 0 && id < EMITTER_COUNT) ? id : EMITTER_NONE];
+}
+
+int emitterByName(const char* name) {
+    for (int i = 0; i < EMITTER_COUNT; ++i) {
+        if (strcmp(name, NAMES[i]) == 0) return i;
+    }
+    return -1;
+}
+
+int emitVolley(const EmitterPattern& p, float x, float y, float targetX, float targetY,
+               float& angle, BulletStore& store) {
+    float first, step;
+    switch (p.kind) {
+        case EMIT_AIMED_FAN:
+            step = p.step;
+            first = atan2f(targetY - y, targetX - x) - step * (p.count - 1) * 0.5f;
+            break;
+        case EMIT_PLASMA_WAVE:
+            step = p.step;
+            first = DOWN - step * (p.count - 1) * 0.5f;
+            break;
+        case EMIT_SPIRAL:
+            step = TWO_PI / p.count;
+            first = angle;
+            angle = fmodf(angle + p.step, TWO_PI);
+            break;
+        default: // EMIT_RADIAL
+            step = TWO_PI / p.count;
+            first = angle;
+            break;
+    }
+
+    int spawned = 0;
+    for (int i = 0; i < p.count; ++i) {
+        float a = first + step * i;
+        if (store.spawn(x, y, cosf(a) * p.speed, sinf(a) * p.speed, p.damage, 0, p.bulletType, false) < 0) break;
+        spawned++;
+    }
+    return spawned;
+}
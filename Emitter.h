@@ -0,0 +1,47 @@
+// Emitter.h
+#ifndef EMITTER_H
+#define EMITTER_H
+
+#include <cstdint>
+
+class BulletStore;
+
+enum EmitterKind : uint8_t {
+    EMIT_RADIAL,     // count bullets evenly around a full circle
+    EMIT_SPIRAL,     // Radial arms that turn by step every volley
+    EMIT_AIMED_FAN,  // Fan centred on the target, step radians apart
+    EMIT_PLASMA_WAVE // Downward fan of wavy plasma bullets
+};
+
+// A firing pattern in 16 bytes: every interval seconds, one volley of count
+// bullets of bulletType.
+struct EmitterPattern {
+    uint8_t kind;       // EmitterKind
+    uint8_t count;      // Bullets per volley
+    uint8_t bulletType; // BulletType
+    uint8_t damage;
+    float interval;     // Seconds between volleys
+    float speed;        // Pixels/second
+    float step;         // Radians between bullets (fan, wave) or per volley (spiral)
+};
+
+// Built-in patterns, indexed by Enemy::emitter
+enum EmitterId : uint8_t {
+    EMITTER_NONE = 0,
+    EMITTER_AIMED_FAN,
+    EMITTER_RADIAL,
+    EMITTER_SPIRAL,
+    EMITTER_PLASMA_WAVE,
+    EMITTER_COUNT
+};
+
+const EmitterPattern& emitterPattern(int id);
+int emitterByName(const char* name); // "none", "fan", "radial", "spiral", "plasma"; -1 if unknown
+const char* emitterName(int id);
+
+// Appends one volley from (x, y) to store (enemy-owned). angle is the
+// emitter's running angle, advanced by spirals. Returns bullets spawned.
+int emitVolley(const EmitterPattern& p, float x, float y, float targetX, float targetY,
+               float& angle, BulletStore& store);
+
+#endif
@@ -2,8 +2,8 @@
 #ifndef ENEMY_H
 #define ENEMY_H
 
-#include <SDL2/SDL.h> // Include SDL for SDL_Renderer
 #include "DamageEvent.h" // Include DamageEvent
+#include "Random.h"
 
 class Enemy {
 public:
@@ -21,12 +21,15 @@ public:
     float prevY = 0.0f;     // Added for motion blur/trail
     float hitTimer = 0.0f;  // New: for local hit feedback
     bool isElite;
+    uint8_t emitter = 0;     // EmitterId; 0 = does not fire
+    float fireTimer = 0.0f;  // Seconds to the next volley
+    float emitAngle = 0.0f;  // Running angle of spiral/radial emitters
+    uint32_t serial = 0;     // Spawn order in its game (GameState::nextEnemySerial)
 
     Enemy(); // Default constructor
     Enemy(float px, float py, int php, int ptype, float pspeed, int ppattern);
     void update(float deltaTime);
-    DamageEvent takeDamage(int baseDamage); // Changed signature
-    void render(SDL_Renderer* renderer); // Added render method
+    DamageEvent takeDamage(int baseDamage, Random& rng); // rng: the game's gameplay stream
 };
 
 #endif
\ No newline at end of file
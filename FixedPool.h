@@ -0,0 +1,108 @@
+// FixedPool.h
+#ifndef FIXEDPOOL_H
+#define FIXEDPOOL_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include "ObjectPool.h" // PoolReset, PoolStats
+
+// Pool with a compile-time capacity whose objects live inline in one aligned
+// block (no per-object allocation, dense in memory). Released slots form an
+// intrusive free list threaded through their own storage, and never-used
+// slots are handed out by a bump index, so construction touches nothing:
+// a 1M-entry pool costs nothing until objects are acquired.
+//
+// Objects are built in place by PoolReset<T> on every acquire. Big pools
+// should live on the heap (std::unique_ptr<FixedPool<T, N>>).
+template <typename T, size_t Capacity>
+class FixedPool {
+    static_assert(Capacity > 0 && Capacity < UINT32_MAX, "FixedPool capacity out of range");
+
+private:
+    enum : uint32_t { NONE = UINT32_MAX };
+
+    typedef typename std::aligned_storage<
+        (sizeof(T) > sizeof(uint32_t) ? sizeof(T) : sizeof(uint32_t)),
+        (alignof(T) > alignof(uint32_t) ? alignof(T) : alignof(uint32_t))>::type Slot;
+
+    Slot slots[Capacity];
+    uint32_t activePos[Capacity]; // slot -> index in activeObjects, NONE once released
+    uint32_t freeHead;            // First released slot, NONE when empty
+    uint32_t fresh;               // Slots [fresh, Capacity) were never handed out
+    PoolStats counters;
+
+    uint32_t& link(uint32_t slot) { return *reinterpret_cast<uint32_t*>(&slots[slot]); }
+    uint32_t slotOf(const T* obj) const {
+        return (uint32_t)(reinterpret_cast<const Slot*>(obj) - slots);
+    }
+
+public:
+    // Live objects in no particular order (swap-remove on release).
+    std::vector<T*> activeObjects;
+
+    FixedPool() : freeHead(NONE), fresh(0) {
+        counters.capacity = Capacity;
+    }
+
+    ~FixedPool() {
+        for (T* obj : activeObjects) obj->~T();
+    }
+
+    FixedPool(const FixedPool&) = delete;
+    FixedPool& operator=(const FixedPool&) = delete;
+
+    static constexpr size_t capacity() { return Capacity; }
+    size_t size() const { return activeObjects.size(); }
+    const PoolStats& stats() const { return counters; }
+
+    T* acquire() {
+        uint32_t slot;
+        if (freeHead != NONE) {
+            slot = freeHead;
+            freeHead = link(slot);
+        } else if (fresh < Capacity) {
+            slot = fresh++;
+        } else {
+            counters.misses++;
+            return nullptr;
+        }
+
+        T* obj = PoolReset<T>::apply(&slots[slot]);
+        obj->active = true;
+        activePos[slot] = (uint32_t)activeObjects.size();
+        activeObjects.push_back(obj);
+        if (activeObjects.size() > counters.highWater) counters.highWater = activeObjects.size();
+        return obj;
+    }
+
+    // O(1): the slot is found by address. Like ObjectPool::release(T*), a
+    // pointer that is not live here (already released, or from another pool)
+    // is ignored rather than corrupting the free list.
+    void release(T* obj) {
+        uint32_t slot = slotOf(obj);
+        if (slot >= fresh || activePos[slot] == NONE) return;
+        releaseAt(activePos[slot]);
+    }
+
+    // Release by position in activeObjects; the last active object moves into index.
+    void releaseAt(size_t index) {
+        if (index >= activeObjects.size()) return;
+
+        T* obj = activeObjects[index];
+        uint32_t slot = slotOf(obj);
+
+        T* moved = activeObjects.back();
+        activeObjects[index] = moved;
+        activePos[slotOf(moved)] = (uint32_t)index;
+        activeObjects.pop_back();
+        activePos[slot] = NONE;
+
+        obj->~T();
+        link(slot) = freeHead; // The dead object's storage now holds the free-list link
+        freeHead = slot;
+    }
+};
+
+#endif
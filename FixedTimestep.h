@@ -0,0 +1,39 @@
+// FixedTimestep.h
+#ifndef FIXEDTIMESTEP_H
+#define FIXEDTIMESTEP_H
+
+// Accumulator for running the simulation at a fixed tick rate independent of
+// the display refresh rate. Feed it each frame's real elapsed time; it says how
+// many ticks to run and how far between the last two ticks the frame sits.
+class FixedTimestep {
+public:
+    FixedTimestep(float ticksPerSecond, int pmaxStepsPerFrame)
+        : tickDt(1.0f / ticksPerSecond), maxStepsPerFrame(pmaxStepsPerFrame), accumulator(0.0) {}
+
+    // Returns the number of ticks to simulate this frame. When the sim falls
+    // behind by more than maxStepsPerFrame ticks the excess time is dropped
+    // (the game slows down instead of spiralling).
+    int advance(double frameSeconds) {
+        accumulator += frameSeconds;
+        int steps = (int)(accumulator / tickDt);
+        if (steps > maxStepsPerFrame) {
+            steps = maxStepsPerFrame;
+            accumulator = 0.0;
+        } else {
+            accumulator -= steps * (double)tickDt;
+        }
+        return steps;
+    }
+
+    // Fraction [0,1) of a tick elapsed since the last simulated tick.
+    float alpha() const { return (float)(accumulator / tickDt); }
+
+    float tickSeconds() const { return tickDt; }
+
+private:
+    float tickDt;
+    int maxStepsPerFrame;
+    double accumulator;
+};
+
+#endif
@@ -0,0 +1,288 @@
+// GameRenderer.cpp
+#include "GameRenderer.h"
+#include <cmath>     // For sinf
+#include <algorithm> // For std::min
+
+static float lerp(float from, float to, float t) {
+    return from + (to - from) * t;
+}
+
+GameRenderer::GameRenderer(SDL_Renderer* prenderer)
+    : renderer(prenderer),
+      background(1, 1), // resized once the output size is known
+      profiler(nullptr),
+      showProfiler(false)
+{
+    int w, h;
+    SDL_GetRendererOutputSize(renderer, &w, &h);
+    background.resize(w, h);
+    background.setCached(true);
+}
+
+void GameRenderer::update(float deltaTime, const RenderSnapshot& snapshot) {
+    if (snapshot.isGameOver) return;
+
+    float intensity = snapshot.currentWave * 0.12f; // ajuste fino
+    background.update(deltaTime, intensity); // Update background
+}
+
+void GameRenderer::render(const RenderSnapshot& snapshot, float alpha) {
+    // --- Limpa tela ---
+    SDL_SetRenderDrawColor(renderer, 10, 10, 15, 255);
+    SDL_RenderClear(renderer);
+
+    // Screen shake: offset rolled when the snapshot was captured
+    SDL_Rect vp{ snapshot.shakeX, snapshot.shakeY, GameState::SCREEN_WIDTH, GameState::SCREEN_HEIGHT };
+    SDL_RenderSetViewport(renderer, &vp);
+
+    // --- Render background ---
+    {
+        PROFILE_SCOPE(profiler, PHASE_RENDER_BACKGROUND);
+        background.render(renderer);
+    }
+
+    // Entities keep the renderer's default (no) blending, as when drawn one by one
+    batch.setBlendMode(SDL_BLENDMODE_NONE);
+
+    {
+        PROFILE_SCOPE(profiler, PHASE_RENDER_ENEMIES);
+        // --- Render player ---
+        renderPlayer(snapshot.player, alpha);
+
+        // --- Render enemies ---
+        for (const RenderSnapshot::EnemySprite& e : snapshot.enemies) {
+            renderEnemy(e, alpha);
+        }
+    }
+
+    // --- Render bullets ---
+    {
+        PROFILE_SCOPE(profiler, PHASE_RENDER_BULLETS);
+        for (const RenderSnapshot::BulletSprite& b : snapshot.bullets) {
+            renderBullet(b, alpha);
+        }
+        for (const RenderSnapshot::BulletSprite& b : snapshot.enemyBullets) {
+            renderEnemyBullet(b, alpha);
+        }
+    }
+
+    {
+        PROFILE_SCOPE(profiler, PHASE_RENDER_SUBMIT);
+        batch.flush(renderer);
+    }
+
+    // --- Render Damage Numbers ---
+    {
+        PROFILE_SCOPE(profiler, PHASE_RENDER_NUMBERS);
+        renderDamageNumbers(snapshot.damageNumbers);
+    }
+
+    if (showProfiler && profiler) {
+        SDL_RenderSetViewport(renderer, nullptr); // Steady: no screen shake
+        renderProfilerOverlay();
+    }
+}
+
+bool GameRenderer::isVisible(float minX, float minY, float maxX, float maxY) {
+    return maxX >= 0.0f && maxY >= 0.0f
+        && minX <= GameState::SCREEN_WIDTH && minY <= GameState::SCREEN_HEIGHT;
+}
+
+void GameRenderer::renderPlayer(const RenderSnapshot::PlayerSprite& player, float alpha) {
+    float px = lerp(player.prevX, player.x, alpha);
+    SDL_Rect playerRect = {static_cast<int>(px - 10), static_cast<int>(player.y - 10), 20, 20};
+    // Blink during iframes (RF13), ~12 times a second
+    bool blink = player.invulnerableTimer > 0.0f && (int)(player.invulnerableTimer * 24.0f) % 2 == 0;
+    batch.fillRect(playerRect, blink ? SDL_Color{255, 80, 80, 120} : SDL_Color{255, 255, 255, 255});
+}
+
+void GameRenderer::renderEnemy(const RenderSnapshot::EnemySprite& e, float alpha) {
+    float x = lerp(e.prevX, e.x, alpha);
+    float y = lerp(e.prevY, e.y, alpha);
+    float hpRatio = e.hpRatio; // Normalized when captured
+
+    // --- Pulso orgânico ---
+    float pulse = 0.5f + 0.5f * sinf(e.pulsePhase);
+    float size = e.radius * (0.9f + pulse * 0.15f);
+
+    // Outermost glow layer and the trail define the drawn extent
+    float reach = size + 6.0f;
+    if (!isVisible(std::min(x, e.prevX) - reach, std::min(y, e.prevY) - reach,
+                   std::max(x, e.prevX) + reach, std::max(y, e.prevY) + reach)) {
+        return;
+    }
+
+    // --- Cor baseada no tipo ---
+    Uint8 r_base = 180, g_base = 60, b_base = 60;
+    if (e.type == 1) { r_base = 60; g_base = 160; b_base = 255; } // Type 'B'
+    if (e.type == 2) { r_base = 255; g_base = 120; b_base = 40; } // Type 'C'
+
+    // --- Intensidade pelo HP ---
+    Uint8 r_final = (Uint8)(r_base * (0.4f + 0.6f * hpRatio));
+    Uint8 g_final = (Uint8)(g_base * (0.4f + 0.6f * hpRatio));
+    Uint8 b_final = (Uint8)(b_base * (0.4f + 0.6f * hpRatio));
+
+    // --- Mix with white for hitFlash ---
+    float hitIntensity = e.hitTimer > 0 ? (e.hitTimer / 0.12f) : 0.0f;
+    r_final = (Uint8)std::min(255.0f, r_final + hitIntensity * (255 - r_final));
+    g_final = (Uint8)std::min(255.0f, g_final + hitIntensity * (255 - g_final));
+    b_final = (Uint8)std::min(255.0f, b_final + hitIntensity * (255 - b_final));
+
+    // --- Rastro temporal ---
+    batch.line((int)e.prevX, (int)e.prevY, (int)x, (int)y, SDL_Color{r_final, g_final, b_final, 40});
+
+    // --- Glow externo (camadas baratas) ---
+    for (int i = 3; i >= 1; --i) {
+        Uint8 glowAlpha = (Uint8)(30 * i);
+
+        SDL_Rect glow = {
+            (int)(x - size - i * 2),
+            (int)(y - size - i * 2),
+            (int)((size * 2) + i * 4),
+            (int)((size * 2) + i * 4)
+        };
+
+        batch.fillRect(glow, SDL_Color{r_final, g_final, b_final, glowAlpha});
+    }
+
+    // --- Núcleo ---
+    SDL_Rect core = {
+        (int)(x - size),
+        (int)(y - size),
+        (int)(size * 2),
+        (int)(size * 2)
+    };
+    batch.fillRect(core, SDL_Color{r_final, g_final, b_final, 220});
+}
+
+void GameRenderer::renderBullet(const RenderSnapshot::BulletSprite& b, float alpha) {
+    float x = lerp(b.prevX, b.x, alpha);
+    float y = lerp(b.prevY, b.y, alpha);
+    float vx = b.vx;
+    float vy = b.vy;
+
+    // Largest bullet sprite (laser core) spans 10px above, trails are short
+    if (!isVisible(x - 16.0f, y - 16.0f, x + 16.0f, y + 16.0f)) return;
+
+    switch (b.type) {
+        case BULLET_LASER: {
+            SDL_Color color{255, 220, 120, 255}; // Trail color
+            batch.line((int)x, (int)y, (int)(x - vx * 0.015f), (int)(y - vy * 0.015f), color);
+
+            SDL_Rect core = {(int)x - 2, (int)y - 10, 4, 12}; // Core as a rectangle
+            batch.fillRect(core, color);
+            break;
+        }
+        case BULLET_SPREAD: {
+            SDL_Color color{180, 255, 180, 200};
+            batch.line((int)x, (int)y, (int)(x - vx * 0.02f), (int)(y - vy * 0.02f), color);
+            SDL_Rect core = {(int)x - 2, (int)y - 2, 4, 4};
+            batch.fillRect(core, color);
+            break;
+        }
+        case BULLET_PLASMA: {
+            int plasmaSize = 3 + (int)(sinf(b.wavePhase * 2.0f) * 1.5f);
+            SDL_Rect plasmaRect = {(int)x - plasmaSize, (int)y - plasmaSize, plasmaSize * 2, plasmaSize * 2};
+            batch.fillRect(plasmaRect, SDL_Color{180, 120, 255, 160});
+            break;
+        }
+    }
+}
+
+// Enemy shots: round-ish orbs in hostile colors, easy to tell from the player's
+void GameRenderer::renderEnemyBullet(const RenderSnapshot::BulletSprite& b, float alpha) {
+    float x = lerp(b.prevX, b.x, alpha);
+    float y = lerp(b.prevY, b.y, alpha);
+    if (!isVisible(x - 5.0f, y - 5.0f, x + 5.0f, y + 5.0f)) return;
+
+    if (b.type == BULLET_PLASMA) {
+        int size = 4 + (int)(sinf(b.wavePhase * 2.0f) * 1.5f);
+        batch.fillRect(SDL_Rect{(int)x - size, (int)y - size, size * 2, size * 2}, SDL_Color{255, 80, 200, 180});
+        return;
+    }
+    batch.fillRect(SDL_Rect{(int)x - 4, (int)y - 3, 8, 6}, SDL_Color{255, 70, 70, 230});
+    batch.fillRect(SDL_Rect{(int)x - 3, (int)y - 4, 6, 8}, SDL_Color{255, 70, 70, 230});
+    batch.fillRect(SDL_Rect{(int)x - 1, (int)y - 1, 2, 2}, SDL_Color{255, 230, 230, 255}); // Hot core
+}
+
+void GameRenderer::renderDamageNumbers(const std::vector<RenderSnapshot::NumberSprite>& numbers) {
+    bool useAtlas = digitAtlas.build(renderer);
+
+    for (const RenderSnapshot::NumberSprite& dn : numbers) {
+        float scale = dn.critical ? 1.6f : 1.0f;
+        float current_scale = scale * (dn.life / DamageNumberBuffer::LIFETIME + 0.2f); // Scale down as it fades
+
+        // Opaque, like the original rect renderer, which drew with blending
+        // off; only the atlas's transparent gutters blend
+        SDL_Color tint = dn.critical ? SDL_Color{255, 60, 60, 255} : SDL_Color{255, 220, 120, 255};
+
+        queueNumber(dn.value, dn.x, dn.y, current_scale, tint, useAtlas);
+    }
+
+    if (useAtlas) {
+        digitAtlas.flush(renderer);
+    } else {
+        batch.flush(renderer);
+    }
+}
+
+void GameRenderer::queueNumber(int value, float x, float y, float scale, SDL_Color tint, bool useAtlas) {
+    if (useAtlas) {
+        digitAtlas.queueNumber(value, x, y, scale, tint);
+        return;
+    }
+
+    // No render targets: same glyphs as plain rects through the batch
+    int digits[10];
+    int count = DigitAtlas::digitsOf(value, digits);
+    int digit_x_offset = 0;
+    for (int k = 0; k < count; ++k) {
+        SDL_Rect rects[7];
+        int n = DigitAtlas::segmentRects(digits[k], (int)x + digit_x_offset, (int)y, scale, rects);
+        for (int r = 0; r < n; ++r) batch.fillRect(rects[r], tint);
+        digit_x_offset += (int)(DigitAtlas::GLYPH_ADVANCE * scale); // Advance X for next digit
+    }
+}
+
+// One row per phase: color swatch, bar (1 ms = 20 px) and the average in
+// microseconds over the last 60 frames; then frame time, enemies and bullets.
+// Digits only (the atlas has no letters), so phases are told apart by color
+// in ProfilePhase order.
+void GameRenderer::renderProfilerOverlay() {
+    static const SDL_Color PHASE_COLORS[PHASE_COUNT] = {
+        {120, 200, 255, 255}, {255, 90, 90, 255}, {255, 230, 90, 255}, {255, 90, 200, 255}, {180, 120, 255, 255},
+        {255, 140, 40, 255},  {255, 190, 190, 255}, {255, 255, 255, 255}, {255, 220, 120, 255}, {120, 255, 140, 255},
+        {60, 90, 160, 255},   {200, 60, 60, 255}, {200, 180, 60, 255}, {150, 150, 150, 255},
+        {200, 160, 90, 255}
+    };
+    const int ROW = 18;
+    const int X = 8, Y = 8;
+    const SDL_Color WHITE = {255, 255, 255, 255};
+
+    Profiler::Frame avg = profiler->average(60);
+    bool useAtlas = digitAtlas.build(renderer);
+
+    batch.setBlendMode(SDL_BLENDMODE_BLEND);
+    batch.fillRect(SDL_Rect{X - 4, Y - 4, 250, ROW * (PHASE_COUNT + 3) + 4}, SDL_Color{0, 0, 0, 170});
+    batch.setBlendMode(SDL_BLENDMODE_NONE);
+
+    for (int p = 0; p < PHASE_COUNT; ++p) {
+        int y = Y + p * ROW;
+        batch.fillRect(SDL_Rect{X, y + 3, 10, 10}, PHASE_COLORS[p]);
+        int bar = std::min((int)(avg.ms[p] * 20.0f), 150);
+        if (bar > 0) batch.fillRect(SDL_Rect{X + 16, y + 5, bar, 6}, PHASE_COLORS[p]);
+        queueNumber((int)(avg.ms[p] * 1000.0f), (float)(X + 172), (float)y, 1.0f, WHITE, useAtlas);
+    }
+
+    // Frame time (us), then entity counts, each behind a white/red/yellow swatch
+    int y = Y + PHASE_COUNT * ROW;
+    const SDL_Color COUNT_COLORS[3] = { WHITE, {255, 90, 90, 255}, {255, 230, 90, 255} };
+    int values[3] = { (int)(avg.totalMs * 1000.0f), (int)avg.enemies, (int)avg.bullets };
+    for (int i = 0; i < 3; ++i, y += ROW) {
+        batch.fillRect(SDL_Rect{X, y + 3, 10, 10}, COUNT_COLORS[i]);
+        queueNumber(values[i], (float)(X + 172), (float)y, 1.0f, WHITE, useAtlas);
+    }
+
+    batch.flush(renderer);
+    if (useAtlas) digitAtlas.flush(renderer);
+}
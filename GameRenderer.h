@@ -0,0 +1,54 @@
+// GameRenderer.h
+#ifndef GAMERENDERER_H
+#define GAMERENDERER_H
+
+#include <SDL2/SDL.h>
+#include "GameState.h"
+#include "RenderSnapshot.h"
+#include "Background.h"
+#include "RenderBatch.h"
+#include "DigitAtlas.h"
+#include "Profiler.h"
+
+// Draws a RenderSnapshot of the game with SDL. The simulation never sees SDL;
+// everything that touches the renderer (background, entities, juice, damage
+// numbers) is here. It never reads the GameState itself, so it can draw while
+// the simulation runs on another thread.
+class GameRenderer {
+public:
+    explicit GameRenderer(SDL_Renderer* prenderer);
+
+    void update(float deltaTime, const RenderSnapshot& snapshot); // Cosmetic-only animation (background)
+    // alpha: fraction of a tick since the snapshot's tick. Positions are
+    // drawn between the previous and current tick (1.0 = latest state).
+    void render(const RenderSnapshot& snapshot, float alpha = 1.0f);
+
+    void setBackgroundCached(bool enabled) { background.setCached(enabled); }
+
+    // Render phase timings go to profiler (nullptr = off); the overlay shows
+    // its recent averages in the top-left corner.
+    void setProfiler(Profiler* p) { profiler = p; }
+    void toggleProfilerOverlay() { showProfiler = !showProfiler; }
+
+private:
+    SDL_Renderer* renderer;
+    Background background;
+    RenderBatch batch; // Player, enemies and bullets go out in a few calls
+    DigitAtlas digitAtlas; // Damage numbers as textured quads, built on first use
+    Profiler* profiler;
+    bool showProfiler;
+
+    // Off-screen entities are skipped (e.g. the spawn queue parked above the top)
+    static bool isVisible(float minX, float minY, float maxX, float maxY);
+
+    void renderPlayer(const RenderSnapshot::PlayerSprite& player, float alpha);
+    void renderEnemy(const RenderSnapshot::EnemySprite& e, float alpha);
+    void renderBullet(const RenderSnapshot::BulletSprite& b, float alpha);
+    void renderEnemyBullet(const RenderSnapshot::BulletSprite& b, float alpha);
+    void renderDamageNumbers(const std::vector<RenderSnapshot::NumberSprite>& numbers);
+    void renderProfilerOverlay();
+    // Through the atlas when useAtlas, else as rects through the batch
+    void queueNumber(int value, float x, float y, float scale, SDL_Color tint, bool useAtlas);
+};
+
+#endif
@@ -1,43 +1,61 @@
 // GameState.cpp (melhorado)
 #include "GameState.h"
 #include <algorithm> // For std::sort, std::clamp
-#include <cstdlib>   // For rand()
-#include <time.h>    // For srand()
-#include "Background.h" // Include Background.h
+#include <cmath>     // For powf
+#include "StateHash.h"
+#include "Emitter.h"
 
-// Initialize static members
-float GameState::screenShake = 0.0f;
-int GameState::hitStopFrames = 0;
-bool GameState::waveInProgress = false; // Initialize waveInProgress
-std::vector<GameState::PendingSpawn> GameState::spawnQueue; // Initialize spawnQueue
-float GameState::spawnTimer = 0.0f; // Initialize spawnTimer
-int GameState::spawnIndex = 0; // Initialize spawnIndex
-std::vector<GameState::DamageNumber> GameState::damageNumbers; // Initialize damageNumbers
-float GameState::impactShake = 0.0f; // Initialize impactShake
-
-
-
-GameState::GameState(SDL_Renderer* prenderer)
+GameState::GameState(unsigned int seed, const WaveTable* table, const SimConfig& pconfig)
     : player(), // Default constructor for Player
       availableUpgrades(), // Default constructor for availableUpgrades
-      currentWave(1),
-      score(0),
-      enemiesKilled(0),
-      nextEliteAt(12),
-      isGameOver(false),
-      renderer(prenderer),
-      bulletPool(100), // Initialize bullet pool with a size
-      enemyPool(50),    // Initialize enemy pool with a size
-      background(1, 1) // temporary
+      config(pconfig),
+      bullets(config.bulletCapacity, config.bulletsGrowable),
+      enemyBullets(config.enemyBulletCapacity, config.enemyBulletsGrowable),
+      enemyPool(config.enemyCapacity, config.enemiesGrowable), // Grows in chunks instead of dropping spawns
+      collisionMode(COLLISION_GRID),
+      waveTable(table),
+      profiler(nullptr),
+      jobs(nullptr),
+      damageNumbers(config.damageNumberCapacity), // Bounded ring
+      // Covers the area bullets live in (culled 10px outside the screen)
+      enemyGrid(GRID_CELL_SIZE, -10.0f, -10.0f, config.worldWidth + 10.0f, config.worldHeight + 10.0f)
 {
-    int w, h;
-    SDL_GetRendererOutputSize(renderer, &w, &h);
-    background = Background(w, h);
+    reset(seed);
+}
 
-    // Initialize random seed
-    srand(time(NULL));
+void GameState::reset(unsigned int seed) {
+    player = Player();
+    // Centered near the bottom of the world (400, 550 in the default 800x600)
+    player.x = player.prevX = config.worldWidth * 0.5f;
+    player.y = config.worldHeight - 50.0f;
+    currentWave = 1;
+    score = 0;
+    enemiesKilled = 0;
+    elitesKilled = 0;
+    playerHitsTaken = 0;
+    nextEliteAt = 12;
+    nextEnemySerial = 0;
+    isGameOver = false;
+
+    // Callers pass time(NULL) or a fixed seed for reproducible runs
+    rng.reseed(seed, 0);
+    cosmeticRng.reseed(seed, 1);
+
+    bullets.clear();
+    enemyBullets.clear();
+    enemyPool.releaseAll();
+
+    screenShake = 0.0f;
+    hitStopTimer = 0.0f;
+    impactShake = 0.0f;
+    spawnQueue.clear();
+    spawnTimer = 0.0f;
+    sweepReach = 0.0f;
+    tickDamageEvents.clear();
+    damageNumbers.clear();
 
     // Populate availableUpgrades with some initial upgrades
+    availableUpgrades.clear();
     availableUpgrades.push_back(Upgrade(1, "Spread Shot", "spread", 2, 1));
     availableUpgrades.push_back(Upgrade(2, "Fire Rate", "fireRate", 1, 1));
 
@@ -50,214 +68,423 @@ GameState::GameState(SDL_Renderer* prenderer)
 const float PLAYER_SPEED = 300.0f; // pixels/segundo
 const float BULLET_BASE_SPEED = 500.0f; // pixels/segundo
 
+// Juice timings were tuned at 60 fps; express them in seconds so they behave
+// the same at any tick rate.
+const float HIT_STOP_FRAME = 1.0f / 60.0f;
+
+const int ENEMY_CONTACT_DAMAGE = 20;
+const float ENEMY_BULLET_RADIUS = 3.0f;
+const float FAR_AWAY = 1e18f; // Packed position of a dead enemy: never within reach
+const size_t ENEMY_CHUNK = 1024; // Enemies moved per parallel job
+
+// Per-frame decay factor (tuned at 60 fps) converted to this step's length.
+static float decay(float perFrame, float deltaTime) {
+    return powf(perFrame, deltaTime * 60.0f);
+}
 
-void GameState::handleInput(const SDL_Event& event) {
+
+void GameState::handleInput(const InputState& input) {
     // Usar deltaTime para suavidade (apenas teclas pressionadas)
-    const Uint8* keystates = SDL_GetKeyboardState(nullptr);
     float dx = 0.0f;
-    if (keystates[SDL_SCANCODE_LEFT]) dx -= PLAYER_SPEED;
-    if (keystates[SDL_SCANCODE_RIGHT]) dx += PLAYER_SPEED;
+    if (input.left) dx -= PLAYER_SPEED;
+    if (input.right) dx += PLAYER_SPEED;
 
     player.move(dx); // Pass dx directly
 
-    if (keystates[SDL_SCANCODE_SPACE]) { // Check if space is held down
-        player.shoot(bulletPool, *this); // Use bulletPool here
+    if (input.fire) { // Check if fire is held down
+        player.shoot(bullets, *this);
     }
 }
 
 // checkCollision function implementation
-bool GameState::checkCollision(Bullet* b, Enemy* e) {
-    if (!b || !e) return false;
-    float dx = b->x - e->x;
-    float dy = b->y - e->y;
+// Swept: the bullet's move this tick (prev -> current) against the enemy's
+// radius box, in the enemy's frame so the enemy's own move counts too. Fast
+// bullets at long steps (900 px/s at the 0.05 s clamp is 45 px) cannot skip
+// through an enemy. t = how far along the move the hit happens.
+bool GameState::checkCollision(float x0, float y0, float x1, float y1, const Enemy* e, float& t) const {
+    if (!e) return false;
+    return sweptPointInBox(x0 - e->prevX, y0 - e->prevY, x1 - e->x, y1 - e->y, 0.0f, 0.0f, e->radius, e->radius, t);
+}
+
+// Sorts the hits one bullet just appended (out[first..]) into path order:
+// earliest t first, ties by spawn order (pool slots depend on which enemies
+// died before). A bullet spent by its first hit keeps only that one. Both
+// broad phases feed this, so they agree.
+void GameState::orderBulletHits(std::vector<DamageEvent>& out, size_t first, bool spentByFirst) {
+    auto earlierHit = [](const DamageEvent& a, const DamageEvent& b) {
+        return a.t != b.t ? a.t < b.t : a.enemySerial < b.enemySerial;
+    };
+    size_t n = out.size() - first;
+    if (n <= 1) return;
+    if (spentByFirst) {
+        out[first] = *std::min_element(out.begin() + first, out.end(), earlierHit);
+        out.resize(first + 1);
+        return;
+    }
+    // A handful of hits per bullet: insertion sort beats std::sort's setup
+    for (size_t i = first + 1; i < out.size(); ++i) {
+        DamageEvent hit = out[i];
+        size_t j = i;
+        for (; j > first && earlierHit(hit, out[j - 1]); --j) out[j] = out[j - 1];
+        out[j] = hit;
+    }
+}
 
-    // Use enemy's radius for collision detection
-    return
-        dx > -e->radius &&
-        dx <  e->radius &&
-        dy > -e->radius &&
-        dy <  e->radius;
+// Makes the render interpolation see "no movement" for this tick.
+void GameState::snapPreviousPositions() {
+    player.prevX = player.x;
+    for (Enemy* e : enemyPool.activeObjects) {
+        e->prevX = e->x;
+        e->prevY = e->y;
+    }
+    bullets.snapPrevious();
+    enemyBullets.snapPrevious();
+}
+
+// Detection's record of a hit; resolveDamageEvents fills in the outcome.
+static DamageEvent hitEvent(size_t bi, const Enemy* e, PoolHandle handle, float t) {
+    DamageEvent ev{};
+    ev.bullet = (uint32_t)bi;
+    ev.enemy = handle;
+    ev.enemySerial = e->serial;
+    ev.x = e->x;
+    ev.y = e->y;
+    ev.t = t;
+    return ev;
+}
+
+// Y-sweep broad phase: enemies sorted by Y, each bullet scans a window
+// covering its move plus the largest enemy radius and enemy move.
+void GameState::buildSweepOrder() {
+    PROFILE_SCOPE(profiler, PHASE_BROADPHASE);
+    // Sort a copy: the pool's active list order belongs to the pool
+    sweepOrder.assign(enemyPool.activeObjects.begin(), enemyPool.activeObjects.end());
+    std::sort(sweepOrder.begin(), sweepOrder.end(),
+        [](Enemy* a, Enemy* b) {
+            return a->y < b->y;
+        }
+    );
+    float maxRadius = 0.0f;
+    float maxStep = 0.0f; // Largest enemy move in Y this tick
+    for (Enemy* e : sweepOrder) {
+        maxRadius = std::max(maxRadius, e->radius);
+        maxStep = std::max(maxStep, fabsf(e->y - e->prevY));
+    }
+    sweepReach = maxRadius + maxStep;
+}
+
+void GameState::queryBulletSweep(size_t bi, std::vector<DamageEvent>& out) const {
+    float x0 = bullets.prevX[bi], y0 = bullets.prevY[bi];
+    float x1 = bullets.x[bi], y1 = bullets.y[bi];
+    float top = std::min(y0, y1) - sweepReach;
+    float bottom = std::max(y0, y1) + sweepReach;
+
+    for (Enemy* e : sweepOrder) {
+        if (!e->active) continue;
+
+        if (e->y < top) continue;   // enemy too far above
+        if (e->y > bottom) break;   // Passed the window (because sorted!)
+
+        // Now, check actual collision
+        float t;
+        if (checkCollision(x0, y0, x1, y1, e, t)) out.push_back(hitEvent(bi, e, enemyPool.handleOf(e), t));
+    }
+}
+
+// Uniform grid broad phase: enemies are binned by the AABB they swept this
+// tick once, each bullet only tests the enemies in the cells its move crosses.
+void GameState::buildEnemyGrid() {
+    const std::vector<Enemy*>& enemies = enemyPool.activeObjects;
+
+    PROFILE_SCOPE(profiler, PHASE_BROADPHASE);
+    enemyGrid.clear();
+    for (size_t i = 0; i < enemies.size(); ++i) {
+        const Enemy* e = enemies[i];
+        if (!e->active) continue;
+        enemyGrid.insert((uint32_t)i, std::min(e->x, e->prevX) - e->radius, std::min(e->y, e->prevY) - e->radius,
+                         std::max(e->x, e->prevX) + e->radius, std::max(e->y, e->prevY) + e->radius);
+    }
+    enemyGrid.build();
+}
+
+void GameState::queryBulletGrid(size_t bi, std::vector<uint32_t>& scratch, std::vector<DamageEvent>& out) const {
+    const std::vector<Enemy*>& enemies = enemyPool.activeObjects;
+    float x0 = bullets.prevX[bi], y0 = bullets.prevY[bi];
+    float x1 = bullets.x[bi], y1 = bullets.y[bi];
+
+    for (uint32_t ei : enemyGrid.querySegment(x0, y0, x1, y1, scratch)) {
+        Enemy* e = enemies[ei];
+        float t;
+        if (checkCollision(x0, y0, x1, y1, e, t)) out.push_back(hitEvent(bi, e, enemyPool.handleAt(ei), t));
+    }
+}
+
+// The per-bullet queries only read positions, so they run in parallel chunks
+// (with a job system), each into its own buffer. Joining the buffers in chunk
+// order gives the same event list for any thread count.
+void GameState::queryBulletHits() {
+    size_t n = bullets.size();
+    size_t chunks = (n + COLLISION_CHUNK - 1) / COLLISION_CHUNK;
+    if (chunkEvents.size() < chunks) chunkEvents.resize(chunks);
+    size_t workers = jobs ? jobs->workerCount() : 1;
+    if (workerCandidates.size() < workers) workerCandidates.resize(workers);
+
+    bool grid = collisionMode == COLLISION_GRID;
+    JobSystem::forEachChunk(jobs, n, COLLISION_CHUNK, [&](size_t begin, size_t end, unsigned worker) {
+        std::vector<DamageEvent>& out = chunkEvents[begin / COLLISION_CHUNK];
+        out.clear();
+        for (size_t bi = begin; bi < end; ++bi) {
+            if (bullets.isDestroyed(bi) || !bullets.isPlayerOwned(bi)) continue;
+            size_t first = out.size();
+            if (grid) {
+                queryBulletGrid(bi, workerCandidates[worker], out);
+            } else {
+                queryBulletSweep(bi, out);
+            }
+            orderBulletHits(out, first, bullets.pierce[bi] <= 0);
+        }
+    });
+
+    tickDamageEvents.clear();
+    for (size_t c = 0; c < chunks; ++c) {
+        tickDamageEvents.insert(tickDamageEvents.end(), chunkEvents[c].begin(), chunkEvents[c].end());
+    }
+}
+
+// Applies the tick's hits in event order: hp, crit rolls, pierce and kills,
+// dropping a bullet's hits after it is spent (this keeps every rng draw in
+// the single-threaded order). Damage numbers, synergies and juice then run
+// as one batch over the events that were applied.
+void GameState::resolveDamageEvents() {
+    std::vector<DamageEvent>& events = tickDamageEvents;
+    size_t applied = 0;
+    uint32_t spent = UINT32_MAX;
+    for (size_t i = 0; i < events.size(); ++i) {
+        DamageEvent ev = events[i];
+        if (ev.bullet == spent) continue; // Its later hits come after it was used up
+
+        Enemy* e = enemyPool.get(ev.enemy);
+        if (player.hasExecute && e->hp < e->maxHp * 0.2f) {
+            e->hp = 0;
+            ev.executed = true;
+        } else {
+            DamageEvent roll = e->takeDamage(bullets.damage[ev.bullet], rng);
+            ev.amount = roll.amount;
+            ev.critical = roll.critical;
+        }
+        ev.killed = e->hp <= 0;
+
+        if (bullets.pierce[ev.bullet] <= 0) {
+            bullets.markDestroyed(ev.bullet);
+            spent = ev.bullet;
+        } else {
+            bullets.pierce[ev.bullet]--;
+        }
+        events[applied++] = ev;
+    }
+    events.resize(applied);
+    if (applied == 0) return;
+
+    int criticals = 0;
+    for (const DamageEvent& ev : events) {
+        if (ev.executed) {
+            triggerExecuteFX();
+        } else {
+            // Create DamageNumber (or add into this enemy's latest one when coalescing)
+            const Enemy* e = enemyPool.get(ev.enemy);
+            damageNumbers.add(ev.x, ev.y - e->radius, ev.amount, ev.critical, ev.enemy);
+            if (ev.critical) criticals++;
+        }
+        if (ev.killed && player.hasShatter) {
+            spawnShatterFragments(ev.x, ev.y);
+        }
+    }
+
+    if (criticals > 0) {
+        impactShake = std::min(impactShake + 2.0f * criticals, 4.0f); // Impact shake per critical hit
+    }
+    screenShake = std::max(screenShake, 1.5f); // Micro shake on bullet hit
+    hitStopTimer = 3 * HIT_STOP_FRAME; // Apply hit stop
+}
+
+void GameState::detectBulletHits() {
+    if (collisionMode == COLLISION_GRID) {
+        buildEnemyGrid();
+    } else {
+        buildSweepOrder();
+    }
+    PROFILE_SCOPE(profiler, PHASE_COLLISION);
+    queryBulletHits();
+}
+
+void GameState::collideBullets() {
+    detectBulletHits();
+    PROFILE_SCOPE(profiler, PHASE_HIT_RESOLVE);
+    resolveDamageEvents();
+}
+
+void GameState::hitPlayer(int damage) {
+    playerHitsTaken++;
+    if (!config.playerTakesDamage || !player.takeDamage(damage)) return;
+
+    screenShake = std::max(screenShake, 6.0f);
+    impactShake = std::min(impactShake + 4.0f, 10.0f);
+    hitStopTimer = 4 * HIT_STOP_FRAME;
+}
+
+// Everything against one hitbox, so the narrowphase is a SIMD scan of packed
+// positions rather than a broadphase. At most one hit a tick lands (iframes
+// start with it), so each scan stops at the first overlap, and during iframes
+// nothing is tested. Enemy bullets that land are spent; enemies are not.
+void GameState::collidePlayer() {
+    if (player.isInvulnerable()) return;
+
+    const std::vector<Enemy*>& enemies = enemyPool.activeObjects;
+    size_t n = enemies.size();
+    size_t padded = (n + 7) & ~(size_t)7;
+    if (packedX.size() < padded) {
+        packedX.resize(padded);
+        packedY.resize(padded);
+        packedRadius.resize(padded);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        const Enemy* e = enemies[i];
+        bool alive = e->active && e->hp > 0; // Killed this tick, released next tick
+        packedX[i] = alive ? e->x : FAR_AWAY;
+        packedY[i] = e->y;
+        packedRadius[i] = e->radius;
+    }
+    if (firstCircleOverlap(packedX.data(), packedY.data(), packedRadius.data(), n,
+                           player.x, player.y, Player::HIT_RADIUS) >= 0) {
+        hitPlayer(ENEMY_CONTACT_DAMAGE);
+        return;
+    }
+
+    long bi = firstPointInCircle(enemyBullets.x.get(), enemyBullets.y.get(), enemyBullets.size(),
+                                 player.x, player.y, Player::HIT_RADIUS + ENEMY_BULLET_RADIUS);
+    if (bi >= 0) {
+        enemyBullets.markDestroyed((size_t)bi);
+        hitPlayer(enemyBullets.damage[bi]);
+    }
 }
 
 void GameState::update(float deltaTime) {
+    tickDamageEvents.clear(); // damageEvents() only ever shows this tick's hits
     if (isGameOver) return;
 
-    float intensity = currentWave * 0.12f; // ajuste fino
-    background.update(deltaTime, intensity); // Update background
-
     // Clamp dt pra evitar explosões em lag
     if (deltaTime > 0.05f) deltaTime = 0.05f;
 
     // Hit stop logic
-    if (hitStopFrames > 0) {
-        hitStopFrames--;
+    if (config.hitStop && hitStopTimer > 0.0f) {
+        hitStopTimer -= deltaTime;
         // Still allow some updates during hitstop for effects that shouldn't freeze
         // For example, screen shake decay, but not game logic
-        screenShake *= 0.85f;
+        screenShake *= decay(0.85f, deltaTime);
         // flash *= 0.9f; // Removed
+        snapPreviousPositions(); // Nothing moves, so interpolation must not either
         return; // Skip game logic updates during hitstop
     }
 
     // --- Player ---
-    player.update(deltaTime); // Update player logic (e.g., cooldowns, invincibility frames)
+    player.update(deltaTime, config.worldWidth); // Update player logic (e.g., cooldowns, invincibility frames)
 
     // --- Spawn Management ---
     spawnTimer += deltaTime;
-    while (!spawnQueue.empty() && spawnTimer >= spawnQueue.front().delay) {
-        PendingSpawn ps = spawnQueue.front();
-        spawnQueue.erase(spawnQueue.begin());
-
-        Enemy* e = enemyPool.acquire();
-        if (e) {
-            e->x = SCREEN_WIDTH * 0.5f + ps.xOffset; // Centered lane + offset
-            e->y = -spawnIndex * 90.0f; // One after another off-screen
-            e->hp = 30 + currentWave * 5; // Base HP + wave scaling
-            e->maxHp = e->hp;
-            e->type = ps.type;
-            e->speed = 80.0f + currentWave * 5.0f; // Adjusted speed based on wave and type
-            e->pattern = 0; // Default pattern for now
-            e->active = true;
-            e->hitTimer = 0.0f; // Reset hitTimer
-            spawnIndex++; // Increment for next enemy in queue
+    {
+        PROFILE_SCOPE(profiler, PHASE_SPAWN);
+        while (spawnQueue.due(spawnTimer)) {
+            Enemy* e = enemyPool.acquireCopy(spawnQueue.front()); // Pre-built in advanceWave
+            spawnQueue.pop();
+            if (e) {
+                e->y = -spawnIndex * 90.0f; // One after another off-screen
+                e->prevY = e->y;
+                e->serial = nextEnemySerial++;
+                spawnIndex++; // Increment for next enemy in queue
+            }
         }
     }
     
     // --- Enemies ---
-    auto& enemies = enemyPool.activeObjects;
-    size_t i_enemy = 0;
-    while (i_enemy < enemies.size()) {
-        Enemy* e = enemies[i_enemy];
-        e->update(deltaTime);
-
-        // Check if enemy is off-screen or takes damage from player (not collision yet)
-        if (e->hp <= 0 || e->y > SCREEN_HEIGHT + e->radius) { // Enemy off-screen or dead
-            if (e->hp <= 0) { // It was actually killed
-                enemiesKilled++;
-                score += (e->type == 0) ? 10 : ((e->type == 1) ? 20 : 50); // Score based on enemy type
-                if (e->isElite) {
-                    onEliteKilled();
+    {
+        PROFILE_SCOPE(profiler, PHASE_ENEMIES);
+        auto& enemies = enemyPool.activeObjects;
+        // Movement only touches each enemy itself: parallel chunks. Deaths,
+        // score and releases stay in list order on this thread.
+        JobSystem::forEachChunk(jobs, enemies.size(), ENEMY_CHUNK, [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i < end; ++i) enemies[i]->update(deltaTime);
+        });
+
+        size_t i_enemy = 0;
+        while (i_enemy < enemies.size()) {
+            Enemy* e = enemies[i_enemy];
+
+            // Check if enemy is off-screen or takes damage from player (not collision yet)
+            if (e->hp <= 0 || e->y > config.worldHeight + e->radius) { // Enemy off-screen or dead
+                if (e->hp <= 0) { // It was actually killed
+                    enemiesKilled++;
+                    score += (e->type == 0) ? 10 : ((e->type == 1) ? 20 : 50); // Score based on enemy type
+                    if (e->isElite) {
+                        onEliteKilled();
+                    }
                 }
-            }
 
-            // impacto visual
-            screenShake = std::max(screenShake, 3.0f); // Intensify shake on enemy death
+                // impacto visual
+                screenShake = std::max(screenShake, 3.0f); // Intensify shake on enemy death
             
-            enemyPool.releaseAt(i_enemy); // Release at current index. Element at i_enemy is replaced by last one.
-
-            // Check for elite spawn AFTER releasing the enemy
-            if (enemiesKilled >= nextEliteAt) {
-                spawnElite();
-                nextEliteAt += 10 + rand() % 6; // 10–15
+                enemyPool.releaseAt(i_enemy); // Release at current index. Element at i_enemy is replaced by last one.
+
+                // Check for elite spawn AFTER releasing the enemy
+                if (enemiesKilled >= nextEliteAt) {
+                    size_t before = enemies.size();
+                    spawnElite();
+                    if (enemies.size() > before) enemies.back()->update(deltaTime); // Moves this tick, like the rest
+                    nextEliteAt += rng.range(10, 15);
+                }
+                // Do not increment i_enemy, as the new element at i_enemy needs to be processed.
+            } else {
+                ++i_enemy; // Only increment if current enemy was not released.
             }
-            // Do not increment i_enemy, as the new element at i_enemy needs to be processed.
-        } else {
-            ++i_enemy; // Only increment if current enemy was not released.
         }
     }
 
     // --- Bullets ---
-    auto& bullets = bulletPool.activeObjects;
-    size_t i_bullet = 0;
-    while (i_bullet < bullets.size()) {
-        Bullet* b = bullets[i_bullet];
-        b->update(deltaTime);
-
-        // Remove bullets off-screen or if marked for destruction
-        if (b->toDestroy || b->y < 0 - 10 || b->y > SCREEN_HEIGHT + 10 || b->x < 0 - 10 || b->x > SCREEN_WIDTH + 10) {
-            bulletPool.releaseAt(i_bullet); // Release at current index.
-            // Do not increment i_bullet.
-        } else {
-            ++i_bullet; // Only increment if current bullet was not released.
-        }
+    // Integrate every bullet and drop off-screen / spent ones in one SIMD pass
+    {
+        PROFILE_SCOPE(profiler, PHASE_BULLETS);
+        bullets.integrateAndCull(deltaTime, -10.0f, -10.0f, config.worldWidth + 10.0f, config.worldHeight + 10.0f, jobs);
     }
 
-    // --- Colisão (BULLET -> ENEMY) ---
-    // Using the Y-sweep broad phase approach
-    // First, sort enemies by Y for efficient sweep
-    std::sort(enemies.begin(), enemies.end(),
-        [](Enemy* a, Enemy* b) {
-            return a->y < b->y;
-        }
-    );
-
-    const float MAX_DIST_Y = 30.0f; // Adjustable
-    for (Bullet* b : bullets) {
-        if (!b->active || !b->isPlayerOwned) continue;
-
-        float by = b->y;
-
-        for (Enemy* e : enemies) {
-            if (!e->active) continue;
-
-            float dy_diff = e->y - by;
-
-            if (dy_diff < -MAX_DIST_Y) continue; // enemy too far above
-            if (dy_diff >  MAX_DIST_Y) break;    // Passed the window (because sorted!)
-
-            // Now, check actual collision
-            if (checkCollision(b, e)) {
-                bool enemyKilled = false;
-                if (player.hasExecute && e->hp < e->maxHp * 0.2f) {
-                    e->hp = 0;
-                    triggerExecuteFX();
-                    enemyKilled = true;
-                } else {
-                    DamageEvent ev = e->takeDamage(b->damage);
-                    // Create DamageNumber
-                    DamageNumber dn;
-                    dn.x = e->x;
-                    dn.y = e->y - e->radius;
-                    dn.value = ev.amount;
-                    dn.critical = ev.critical;
-                    dn.life = 0.8f; // Damage number life in seconds
-                    damageNumbers.push_back(dn);
-
-                    if (ev.critical) {
-                        impactShake = std::min(impactShake + 2.0f, 4.0f); // Trigger impact shake on critical hit
-                    }
-                    if (e->hp <= 0) {
-                        enemyKilled = true;
-                    }
-                }
-
-                if (enemyKilled && player.hasShatter) {
-                    spawnShatterFragments(e->x, e->y);
-                }
+    // --- Enemy fire ---
+    {
+        PROFILE_SCOPE(profiler, PHASE_EMITTERS);
+        fireEmitters(deltaTime);
+        enemyBullets.integrateAndCull(deltaTime, -10.0f, -10.0f, config.worldWidth + 10.0f, config.worldHeight + 10.0f,
+                                      jobs);
+    }
 
-                screenShake = std::max(screenShake, 1.5f); // Micro shake on bullet hit
-                hitStopFrames = 3; // Apply hit stop
+    // --- Colisão (BULLET -> ENEMY) ---
+    collideBullets();
 
-                if (b->pierce <= 0) {
-                    b->toDestroy = true;
-                    break; // Bullet is destroyed, so it can't hit another enemy
-                } else {
-                    b->pierce--;
-                    // Don't break, allow bullet to continue
-                }
-            }
-        }
+    // --- Colisão (ENEMY / ENEMY BULLET -> PLAYER) ---
+    {
+        PROFILE_SCOPE(profiler, PHASE_PLAYER_HITS);
+        collidePlayer();
     }
 
-    // --- Player - Enemy collision ---
-    // TODO: Implement player-enemy collision and damage handling
-
     // Decay visual effects
-    screenShake *= 0.9f; // Decay screenShake
-    impactShake *= 0.85f; // Decay impactShake
+    screenShake *= decay(0.9f, deltaTime); // Decay screenShake
+    impactShake *= decay(0.85f, deltaTime); // Decay impactShake
     // Removed flashTimer decay
 
     // --- Damage Numbers Update ---
-    for (auto it = damageNumbers.begin(); it != damageNumbers.end(); ) {
-        it->y -= deltaTime * 40.0f; // Float upwards
-        it->life -= deltaTime;      // Decay life
-        if (it->life <= 0) {
-            it = damageNumbers.erase(it); // Remove if life is over
-        } else {
-            ++it;
-        }
+    {
+        PROFILE_SCOPE(profiler, PHASE_DAMAGE_NUMBERS);
+        damageNumbers.update(deltaTime); // Expired numbers leave from the tail in O(1)
     }
 
     // --- Wave Management ---
+    PROFILE_SCOPE(profiler, PHASE_WAVE);
     if (waveInProgress) {
         // A wave is considered complete if all enemies that were supposed to spawn have spawned
         // AND all currently active enemies are inactive.
@@ -274,600 +501,178 @@ void GameState::update(float deltaTime) {
     if (player.hp <= 0) isGameOver = true;
 }
 
-        
-
-        void GameState::render() { // Start of GameState::render definition
-
-            // --- Limpa tela ---
-
-            SDL_SetRenderDrawColor(renderer, 10, 10, 15, 255);
-
-            SDL_RenderClear(renderer);
-
-        
-
-            // SCREEN SHAKE OFFSET
-
-                        int shakeX = 0;
-
-                        int shakeY = 0;
-
-                        float totalShake = screenShake + impactShake; // Combine screenShake and impactShake
-
-                        if (totalShake > 0.1f) {
-
-                            int shakeAmount = (int)(totalShake * 2);
-
-                            if (shakeAmount < 1) shakeAmount = 1; // Ensure shakeAmount is at least 1
-
-                            shakeX = (rand() % shakeAmount) - (shakeAmount / 2); // Center around zero
-
-                            shakeY = (rand() % shakeAmount) - (shakeAmount / 2); // Center around zero
-
-                        }
-
-        
-
-            SDL_Rect vp{ shakeX, shakeY, SCREEN_WIDTH, SCREEN_HEIGHT };
-
-                        SDL_RenderSetViewport(renderer, &vp);
-
-            
-
-                                    // --- Render background ---
-
-            
-
-                                    background.render(renderer);
-
-                    
-
-                        // --- Render player ---
-
-                        player.render(renderer);
-
-        
-
-            // --- Render enemies ---
-
-            for (Enemy* e : enemyPool.activeObjects) {
-
-                if (e->active)
-
-                    e->render(renderer);
-
-            }
-
-        
-
-            // --- Render bullets ---
-
-            for (Bullet* b : bulletPool.activeObjects) {
-
-                if (b->active)
-
-                    b->render(renderer);
-
-            }
-
-        
-
-                                    // --- Render Damage Numbers ---
-
-        
-
-                                    // Helper to render a single digit using rectangles
-
-        
-
-                                    auto renderDigit = [&](int digit, int x_pos, int y_pos, float digit_scale, Uint8 r, Uint8 g, Uint8 b, Uint8 alpha) {
-
-        
-
-                                        // Segment definitions for a 7-segment display (horizontal segments first, then vertical)
-
-        
-
-                                        //   ---0---
-
-        
-
-                                        //  |       |
-
-        
-
-                                        //  5       1
-
-        
-
-                                        //  |       |
-
-        
-
-                                        //   ---6---
-
-        
-
-                                        //  |       |
-
-        
-
-                                        //  4       2
-
-        
-
-                                        //  |       |
-
-        
-
-                                        //   ---3---
-
-        
-
-                                        bool segments[7];
-
-        
-
-                                        switch (digit) {
-
-        
-
-                                            case 0: for(int k=0; k<6; ++k) segments[k]=true; segments[6]=false; break; // 0
-
-        
-
-                                            case 1: segments[0]=false; segments[1]=true; segments[2]=true; segments[3]=false; segments[4]=false; segments[5]=false; segments[6]=false; break; // 1
-
-        
-
-                                            case 2: segments[0]=true; segments[1]=true; segments[2]=false; segments[3]=true; segments[4]=true; segments[5]=false; segments[6]=true; break; // 2
-
-        
-
-                                            case 3: segments[0]=true; segments[1]=true; segments[2]=true; segments[3]=true; segments[4]=false; segments[5]=false; segments[6]=true; break; // 3
-
-        
-
-                                            case 4: segments[0]=false; segments[1]=true; segments[2]=true; segments[3]=false; segments[4]=false; segments[5]=true; segments[6]=true; break; // 4
-
-        
-
-                                            case 5: segments[0]=true; segments[1]=false; segments[2]=true; segments[3]=true; segments[4]=false; segments[5]=true; segments[6]=true; break; // 5
-
-        
-
-                                            case 6: segments[0]=true; segments[1]=false; segments[2]=true; segments[3]=true; segments[4]=true; segments[5]=true; segments[6]=true; break; // 6
-
-        
-
-                                            case 7: segments[0]=true; segments[1]=true; segments[2]=true; segments[3]=false; segments[4]=false; segments[5]=false; segments[6]=false; break; // 7 (top, top-right, bottom-right)
-
-        
-
-                                            case 8: for(int k=0; k<7; ++k) segments[k]=true; break; // 8
-
-        
-
-                                            case 9: segments[0]=true; segments[1]=true; segments[2]=true; segments[3]=true; segments[4]=false; segments[5]=true; segments[6]=true; break; // 9
-
-        
-
-                                            default: for(int k=0; k<7; ++k) segments[k]=false; break; // Empty or error
-
-        
-
-                                        }
-
-        
-
-                        
-
-        
-
-                                                                                SDL_SetRenderDrawColor(renderer, r, g, b, alpha);
-
-        
-
-                        
-
-        
 
-                                        
 
-        
+void GameState::advanceWave() {
+    waveInProgress = true; // Set waveInProgress to true when a new wave starts
+    currentWave++;
 
-                        
+    spawnQueue.clear();
+    spawnTimer = 0.0f;
+    spawnIndex = 0; // Reset spawnIndex for new wave
 
-        
-
-                                                                                float seg_w = 2.0f * digit_scale; // Thickness of segments
-
-        
-
-                        
-
-        
-
-                                                                                float seg_h = 2.0f * digit_scale;
-
-        
-
-                        
-
-        
-
-                                                                                float seg_len = 6.0f * digit_scale; // Length of horizontal segments
-
-        
-
-                        
-
-        
-
-                                                                                float vert_len = 6.0f * digit_scale; // Length of vertical segments
-
-        
-
-                        
-
-        
-
-                                        
-
-        
-
-                        
-
-        
-
-                                                                                // Segment 0 (top)
-
-        
-
-                        
-
-        
-
-                                                                                if (segments[0]) { SDL_Rect rect = {(int)(x_pos), (int)(y_pos), (int)seg_len, (int)seg_h}; SDL_RenderFillRect(renderer, &rect); }
-
-        
-
-                        
-
-        
-
-                                                                                // Segment 1 (top-right)
-
-        
-
-                        
-
-        
-
-                                                                                if (segments[1]) { SDL_Rect rect = {(int)(x_pos + seg_len - seg_w), (int)(y_pos), (int)seg_w, (int)vert_len}; SDL_RenderFillRect(renderer, &rect); }
-
-        
-
-                        
-
-        
-
-                                                                                // Segment 2 (bottom-right)
-
-        
-
-                        
-
-        
-
-                                                                                if (segments[2]) { SDL_Rect rect = {(int)(x_pos + seg_len - seg_w), (int)(y_pos + vert_len + seg_h), (int)seg_w, (int)vert_len}; SDL_RenderFillRect(renderer, &rect); }
-
-        
-
-                        
-
-        
-
-                                                                                // Segment 3 (bottom)
-
-        
-
-                        
-
-        
-
-                                                                                if (segments[3]) { SDL_Rect rect = {(int)(x_pos), (int)(y_pos + 2 * vert_len + seg_h), (int)seg_len, (int)seg_h}; SDL_RenderFillRect(renderer, &rect); }
-
-        
-
-                        
-
-        
-
-                                                                                // Segment 4 (bottom-left)
-
-        
-
-                        
-
-        
-
-                                                                                if (segments[4]) { SDL_Rect rect = {(int)(x_pos), (int)(y_pos + vert_len + seg_h), (int)seg_w, (int)vert_len}; SDL_RenderFillRect(renderer, &rect); }
-
-        
-
-                        
-
-        
-
-                                                                                // Segment 5 (top-left)
-
-        
-
-                        
-
-        
-
-                                                                                if (segments[5]) { SDL_Rect rect = {(int)(x_pos), (int)(y_pos), (int)seg_w, (int)vert_len}; SDL_RenderFillRect(renderer, &rect); }
-
-        
-
-                        
-
-        
-
-                                                                                // Segment 6 (middle)
-
-        
-
-                        
-
-        
-
-                                                                                if (segments[6]) { SDL_Rect rect = {(int)(x_pos), (int)(y_pos + vert_len), (int)seg_len, (int)seg_h}; SDL_RenderFillRect(renderer, &rect); }
-
-        
-
-                        
-
-        
-
-                                                                            };
-
-        
-
-                        
-
-        
-
-                        
-
-        
-
-                                    for (const auto& dn : damageNumbers) {
-
-        
-
-                                        float scale = dn.critical ? 1.6f : 1.0f;
-
-        
-
-                                        float current_scale = scale * (dn.life / 0.8f + 0.2f); // Scale down as it fades
-
-        
-
-                        
-
-        
-
-                                        Uint8 cr_base = dn.critical ? 255 : 255;
-
-        
-
-                                        Uint8 cg_base = dn.critical ? 60  : 220;
-
-        
-
-                                        Uint8 cb_base = dn.critical ? 60  : 120;
-
-        
-
-                        
-
-        
-
-                                        Uint8 alpha = (Uint8)(dn.life / 0.8f * 255);
-
-        
-
-                                        if (alpha < 0) alpha = 0; // Ensure alpha is not negative
-
-        
-
-                        
-
-        
-
-                                        Uint8 cr = cr_base;
-
-        
-
-                                        Uint8 cg = cg_base;
-
-        
-
-                                        Uint8 cb = cb_base;
-
-        
-
-                                        // SDL_SetRenderDrawColor(renderer, cr, cg, cb, alpha); // Set per digit
-
-        
-
-                        
-
-        
-
-                                        int val = dn.value;
-
-        
-
-                                        if (val == 0) { // Handle zero case
-
-        
-
-                                            renderDigit(0, (int)dn.x, (int)dn.y, current_scale, cr, cg, cb, alpha);
-
-        
-
-                                        } else {
-
-        
-
-                                            std::string s_val = std::to_string(val); // Convert int to string
-
-        
-
-                                            int digit_x_offset = 0;
-
-        
-
-                                            for (char c : s_val) {
-
-        
-
-                                                int digit = c - '0';
-
-        
-
-                                                renderDigit(digit, (int)dn.x + digit_x_offset, (int)dn.y, current_scale, cr, cg, cb, alpha);
-
-        
-
-                                                digit_x_offset += (int)(8 * current_scale); // Advance X for next digit
-
-        
-
-                                            }
-
-        
-
-                                                                                }
-
-        
-
-                                        
-
-        
-
-                                                                            }
-
-        
-
-                                        } // This closes the GameState::render() function
-
-        
-
-                                        
-
-        
-
-                                        
-
-        
-
-                                        void GameState::advanceWave() {
-
-        
-
-                                            waveInProgress = true; // Set waveInProgress to true when a new wave starts
-
-        
-
-                                            currentWave++;
-
-        
-
-                                        
-
-        
-
-                                            spawnQueue.clear();
-
-        
-
-                                            spawnTimer = 0.0f;
-
-        
-
-                                            spawnIndex = 0; // Reset spawnIndex for new wave
-
-        
-
-                                        
-
-        
-
-                                            int total = 5 + currentWave * 2; // Total enemies in this wave
-
-        
-
-                                        
-
-        
-
-                                            for (int i = 0; i < total; ++i) {
-
-        
-
-                                                PendingSpawn ps;
-
-        
-
-                                                ps.delay = i * 0.5f;          // Rhythm of the wave (0.5s between spawns)
-
-        
-
-                                                ps.type  = rand() % 3;        // Assign a random type (0, 1, or 2)
-
-        
-
-                                                ps.xOffset = (rand() % 60) - 30; // Slight random horizontal offset
-
-        
-
-                                                spawnQueue.push_back(ps);
-
-        
-
-                                            }
+    const WaveRecord* def = waveTable ? waveTable->wave(currentWave) : nullptr;
+    if (def) {
+        queueWaveFromTable(*def);
+    } else {
+        queueWaveFromFormula();
+    }
 
-        
+    // Unlock upgrade example (simplified)
+    if (currentWave % 3 == 0 && !availableUpgrades.empty()) {
+        player.applyUpgrade(availableUpgrades[0]); // Apply first available upgrade
+    }
+}
 
-                                        
+// Pre-warm: allocate every pool slot the wave can need and build each enemy
+// up front, so spawning mid-wave is a slot pop and a copy
+void GameState::queueSpawn(float time, int type, float xOffset, int pattern, int hp, float speed) {
+    Enemy proto;
+    proto.x = config.worldWidth * 0.5f + xOffset; // Centered lane + offset
+    proto.hp = hp;
+    proto.maxHp = proto.hp;
+    proto.type = type;
+    proto.speed = speed;
+    proto.pattern = pattern;
+    proto.hitTimer = 0.0f;
+    proto.prevX = proto.x; // No interpolation from the slot's previous life
+    proto.emitter = type == 1 ? EMITTER_AIMED_FAN : (type == 2 ? EMITTER_RADIAL : EMITTER_NONE);
+    proto.fireTimer = emitterPattern(proto.emitter).interval; // First volley one interval after entering
+    proto.emitAngle = 0.0f;
+    spawnQueue.push(time, proto);
+}
 
-        
+// Sizes the enemy pool for a wave up front so spawning never allocates. A
+// fixed pool (SimConfig::enemiesGrowable off) only gets what fits: it stays
+// at its capacity and the spawns beyond it are misses in acquire.
+void GameState::prewarmEnemies(size_t spawns) {
+    size_t wanted = enemyPool.activeObjects.size() + spawns;
+    if (!enemyPool.isGrowable()) wanted = std::min(wanted, enemyPool.capacity());
+    enemyPool.reserve(wanted);
+}
 
-                                            // Unlock upgrade example (simplified)
+void GameState::queueWaveFromTable(const WaveRecord& wave) {
+    spawnQueue.reserve(wave.spawnCount);
+    prewarmEnemies(wave.spawnCount);
+
+    const SpawnRecord* spawns = waveTable->spawnsOf(wave);
+    for (uint32_t i = 0; i < wave.spawnCount; ++i) {
+        const SpawnRecord& s = spawns[i];
+        // Same draw order as the formula (type, then offset)
+        int type = (s.flags & SpawnRecord::RANDOM_TYPE) ? rng.range(0, 2) : s.type;
+        float xOffset = (s.flags & SpawnRecord::RANDOM_X) ? (float)rng.range(-30, 29) : s.xOffset;
+        int hp = std::max(1, (int)(wave.hp * s.hpScale + 0.5f));
+        queueSpawn(s.time, type, xOffset, s.pattern, hp, wave.speed * s.speedScale);
+    }
+}
 
-        
+void GameState::queueWaveFromFormula() {
+    int total = 5 + currentWave * 2; // Total enemies in this wave
+    spawnQueue.reserve(total);
+    prewarmEnemies(total);
+
+    for (int i = 0; i < total; ++i) {
+        int type = rng.range(0, 2);       // Assign a random type (0, 1, or 2)
+        int xOffset = rng.range(-30, 29); // Slight random horizontal offset
+        queueSpawn(i * 0.5f, // Rhythm of the wave (0.5s between spawns)
+                   type, (float)xOffset, 0,
+                   30 + currentWave * 5,      // Base HP + wave scaling
+                   80.0f + currentWave * 5.0f); // Adjusted speed based on wave and type
+    }
+}
 
-                                            if (currentWave % 3 == 0 && !availableUpgrades.empty()) {
+void GameState::setDamageNumberCoalescing(float windowSeconds) {
+    damageNumbers.setCoalesceWindow(windowSeconds);
+}
 
-        
+static void hashBullets(StateHash& h, const BulletStore& store) {
+    size_t n = store.size();
+    h.add((uint32_t)n);
+    h.addBytes(store.x.get(), n * sizeof(float));
+    h.addBytes(store.y.get(), n * sizeof(float));
+    h.addBytes(store.vx.get(), n * sizeof(float));
+    h.addBytes(store.vy.get(), n * sizeof(float));
+    h.addBytes(store.damage.get(), n * sizeof(int));
+    h.addBytes(store.pierce.get(), n * sizeof(int));
+    h.addBytes(store.type.get(), n);
+    h.addBytes(store.flags.get(), n);
+}
 
-                                                player.applyUpgrade(availableUpgrades[0]); // Apply first available upgrade
+uint64_t GameState::stateHash() const {
+    StateHash h;
+    h.add(currentWave);
+    h.add(score);
+    h.add(enemiesKilled);
+    h.add(elitesKilled);
+    h.add(playerHitsTaken);
+    h.add(nextEliteAt);
+    h.add(isGameOver);
+    h.add(hitStopTimer);
+    h.add(waveInProgress);
+    h.add(spawnTimer);
+    h.add(spawnIndex);
+    h.add((uint32_t)spawnQueue.size());
+
+    h.add(player.x);
+    h.add(player.y);
+    h.add(player.hp);
+    h.add(player.invulnerableTimer);
+    h.add(player.fireRate);
+    h.add(player.shootCooldown);
+    h.add(player.baseDamage);
+    h.add(player.shotsFired);
+    h.add(player.hasOverheat);
+    h.add(player.hasShatter);
+    h.add(player.hasExecute);
+    for (int tag = (int)UpgradeTag::DAMAGE; tag <= (int)UpgradeTag::STATUS; ++tag) {
+        auto it = player.upgrades.find((UpgradeTag)tag); // Fixed order, not map order
+        h.add(it != player.upgrades.end() ? it->second : 0);
+    }
 
-        
+    h.add((uint32_t)enemyPool.activeObjects.size());
+    for (const Enemy* e : enemyPool.activeObjects) {
+        h.add(e->x);
+        h.add(e->y);
+        h.add(e->hp);
+        h.add(e->maxHp);
+        h.add(e->type);
+        h.add(e->speed);
+        h.add(e->pattern);
+        h.add(e->active);
+        h.add(e->radius);
+        h.add(e->hitTimer);
+        h.add(e->isElite);
+        h.add((int)e->emitter);
+        h.add(e->fireTimer);
+        h.add(e->emitAngle);
+    }
 
-                                            }
+    hashBullets(h, bullets);
+    hashBullets(h, enemyBullets);
+    return h.get();
+}
 
-        
+uint64_t GameState::cosmeticHash() const {
+    StateHash h;
+    h.add(screenShake);
+    h.add(impactShake);
+    h.add((uint32_t)damageNumbers.size());
+    for (size_t i = 0; i < damageNumbers.size(); ++i) {
+        const DamageNumber& dn = damageNumbers[i];
+        h.add(dn.x);
+        h.add(dn.y);
+        h.add(dn.value);
+        h.add(dn.life);
+        h.add(dn.critical);
+        h.add(dn.age);
+    }
+    return h.get();
+}
 
-                                        }
 void GameState::spawnElite() {
     Enemy* e = enemyPool.acquire();
     if (!e) return;
+    e->serial = nextEnemySerial++;
 
     e->type = 99; // ELITE
     e->hp = 120
@@ -880,16 +685,37 @@ void GameState::spawnElite() {
     e->active = true;
     e->hitTimer = 0.0f;
 
-    e->x = SCREEN_WIDTH * 0.5f;
+    e->emitter = (currentWave % 2) ? EMITTER_SPIRAL : EMITTER_PLASMA_WAVE; // Mini-boss patterns alternate
+    e->fireTimer = emitterPattern(e->emitter).interval;
+    e->emitAngle = 0.0f;
+
+    e->x = config.worldWidth * 0.5f;
     e->y = -80;
+    e->prevX = e->x;
+    e->prevY = e->y;
 
     // impacto visual
     screenShake = 8.0f;
-    hitStopFrames = 6;
+    hitStopTimer = 6 * HIT_STOP_FRAME;
+}
+
+// Each firing enemy counts down on screen only (nothing shoots from the
+// spawn lane above the top edge); no rng, so enemy fire never shifts gameplay draws
+void GameState::fireEmitters(float deltaTime) {
+    for (Enemy* e : enemyPool.activeObjects) {
+        if (e->emitter == EMITTER_NONE || e->y < 0.0f) continue;
+        e->fireTimer -= deltaTime;
+        if (e->fireTimer > 0.0f) continue;
+
+        const EmitterPattern& p = emitterPattern(e->emitter);
+        e->fireTimer += p.interval;
+        emitVolley(p, e->x, e->y, player.x, player.y, e->emitAngle, enemyBullets);
+    }
 }
 
 void GameState::onEliteKilled() {
-    int roll = rand() % 5;
+    elitesKilled++;
+    int roll = rng.range(0, 4);
 
     if (roll == 0) player.upgradeDamage(*this);
     if (roll == 1) player.upgradeFireRate(*this);
@@ -899,7 +725,7 @@ void GameState::onEliteKilled() {
 
     // feedback
     screenShake = 6.0f;
-    hitStopFrames = 4;
+    hitStopTimer = 4 * HIT_STOP_FRAME;
     impactShake = 10.0f;
 }
 
@@ -919,6 +745,6 @@ void GameState::triggerExecuteFX() {
 void GameState::triggerSynergyFeedback(const std::string& name) {
     // TODO: Implement Synergy Feedback
     screenShake = 12.0f;
-    hitStopFrames = 8;
+    hitStopTimer = 8 * HIT_STOP_FRAME;
     // spawnText(name, GOLD);
 }
\ No newline at end of file
@@ -2,16 +2,26 @@
 #ifndef GAMESTATE_H
 #define GAMESTATE_H
 
-#include <SDL2/SDL.h>
 #include <vector>
 #include <string>
+#include <cstdint>
 #include "Player.h"
 #include "Bullet.h"
 #include "Enemy.h"
 #include "Wave.h"
 #include "Upgrade.h"
 #include "ObjectPool.h" // Include ObjectPool
-#include "Background.h"
+#include "BulletStore.h"
+#include "SpatialGrid.h"
+#include "DamageNumbers.h"
+#include "InputState.h"
+#include "Random.h"
+#include "TimedQueue.h"
+#include "WaveTable.h"
+#include "Profiler.h"
+#include "SimConfig.h"
+#include "Narrowphase.h"
+#include "JobSystem.h"
 
 class GameState {
 public:
@@ -21,23 +31,79 @@ public:
     int currentWave;
     int score;
     int enemiesKilled;
+    int elitesKilled;
+    int playerHitsTaken; // Hits that reached the player (counted even without SimConfig::playerTakesDamage)
     int nextEliteAt;
+    uint32_t nextEnemySerial; // Enemy::serial of the next spawn; whoever spawns assigns it
     bool isGameOver;
-    SDL_Renderer* renderer;
 
-    ObjectPool<Bullet> bulletPool; // Add bullet pool
+    const SimConfig config;        // Capacities and world size, fixed at construction
+    BulletStore bullets;           // Player bullets, structure-of-arrays
+    BulletStore enemyBullets;      // Fired by enemy emitters (Emitter.h), updated in bulk apart from the player's
     ObjectPool<Enemy> enemyPool;   // Add enemy pool
-    Background background;
 
     static const int SCREEN_WIDTH = 800; // Define screen dimensions
     static const int SCREEN_HEIGHT = 600;
 
-    GameState(SDL_Renderer* prenderer);
-    void handleInput(const SDL_Event& event);
+    // Bullet -> enemy broad phase, switchable for A/B benchmarking
+    enum CollisionMode {
+        COLLISION_SWEEP, // Sort enemies by Y, scan a window per bullet
+        COLLISION_GRID   // Bin enemies into a uniform grid, query per bullet
+    };
+    CollisionMode collisionMode;
+    static constexpr float GRID_CELL_SIZE = 64.0f; // >= typical enemy diameter
+
+    // Separate streams: rendering effects draw from cosmeticRng only, so how
+    // often frames are drawn never changes what happens in the game.
+    Random rng;         // Gameplay: crits, spawns, elite timing and loot
+    Random cosmeticRng; // Screen shake and other effects
+
+    // Pure simulation: no SDL, no window. Rendering lives in GameRenderer.
+    // All state is per instance: any number of games can run side by side.
+    explicit GameState(unsigned int seed, const WaveTable* table = nullptr,
+                       const SimConfig& pconfig = SimConfig());
+    // Back to wave 1 with a new seed, as if freshly constructed. Keeps the
+    // allocations and the settings (collisionMode, damage number coalescing).
+    void reset(unsigned int seed);
+    void handleInput(const InputState& input);
     void update(float deltaTime);
-    void render();
     // void checkCollisions(); // Removed, will be integrated into update with juice
     void advanceWave();
+    // Bullet -> enemy pass of update() on its own (for shooter_bench):
+    // detectBulletHits, then the damage events are resolved
+    void collideBullets();
+    // Broad phase and queries only: fills damageEvents() and changes nothing
+    // else, so it can run (and be timed) repeatedly on one scene
+    void detectBulletHits();
+    // Hits found this tick, in bullet order and path order per bullet. After
+    // update() only the ones applied remain, with their outcome filled in.
+    const std::vector<DamageEvent>& damageEvents() const { return tickDamageEvents; }
+    // Enemies and enemy bullets -> player pass of update() (for shooter_bench)
+    void collidePlayer();
+
+    // Merge hits on the same enemy within windowSeconds into one number (0 = off)
+    void setDamageNumberCoalescing(float windowSeconds);
+
+    // Waves found in table come from it, the rest from the built-in formula.
+    // The table is only read, so one can be shared by many games (and threads);
+    // it must outlive them. nullptr = formula only. Applies from the next
+    // advanceWave() or reset().
+    void setWaveTable(const WaveTable* table) { waveTable = table; }
+
+    // Phase timings go to profiler (nullptr = off). Not owned.
+    void setProfiler(Profiler* p) { profiler = p; }
+
+    // Bullet and enemy movement and the bullet -> enemy queries run in chunks
+    // on jobs (nullptr = this thread only). Results are identical for any
+    // thread count. Not owned; must not be shared by games updating at once.
+    void setJobSystem(JobSystem* j) { jobs = j; }
+
+    // Hash of everything that affects gameplay (player, enemies, bullets, score,
+    // wave pacing). Cosmetic state (shake, damage numbers) is left out.
+    uint64_t stateHash() const;
+    // Hash of the cosmetic state stateHash() leaves out: screen/impact shake
+    // and the live damage numbers. For --check-isolation, not for replays.
+    uint64_t cosmeticHash() const;
 
     // Synergy methods
     void spawnOverheatBlast();
@@ -46,38 +112,55 @@ public:
     void triggerSynergyFeedback(const std::string& name);
 
 private:
+    friend struct RenderSnapshot; // Copies shake and damage numbers out to draw them
+
     // Game juice variables
-    static float screenShake;
+    float screenShake;
     // static float flash; // Removed
-    static int hitStopFrames;
+    float hitStopTimer; // Seconds of frozen gameplay left (time-based, not per frame)
     // static float pressure; // Removed
     // static float flashTimer; // Removed
-    static bool waveInProgress; // New: Manages current wave state
+    bool waveInProgress; // New: Manages current wave state
 
     // Wave Pacing variables
-    struct PendingSpawn {
-        float delay;
-        int type;
-        float xOffset; // New: for slight horizontal variation
-        // int pattern; // Can be added later if needed
-    };
-    static std::vector<PendingSpawn> spawnQueue;
-    static float spawnTimer;
-        static int spawnIndex; // New: to keep track of spawned enemies in a wave
+    // Enemies of the current wave, fully built by advanceWave and keyed on
+    // their spawn time; spawning copies one in (only y is set at spawn)
+    TimedQueue<Enemy> spawnQueue;
+    const WaveTable* waveTable;
+    Profiler* profiler;
+    JobSystem* jobs;
+    float spawnTimer;
+        int spawnIndex; // New: to keep track of spawned enemies in a wave
     
         // Damage Numbers
-        struct DamageNumber {
-            float x, y;
-            int value;
-            float life;
-            bool critical;
-        };
-        static std::vector<DamageNumber> damageNumbers;
-    static float impactShake; // New: for screen impact effect
+        DamageNumberBuffer damageNumbers;
+    float impactShake; // New: for screen impact effect
     
         // Collision helper
-    bool checkCollision(Bullet* b, Enemy* e);
+    bool checkCollision(float x0, float y0, float x1, float y1, const Enemy* e, float& t) const;
+    static const size_t COLLISION_CHUNK = 1024; // Bullets per parallel query job
+    std::vector<std::vector<DamageEvent>> chunkEvents;   // Scratch: hits found per chunk of bullets
+    std::vector<DamageEvent> tickDamageEvents;           // This tick's hits, chunks joined in order
+    std::vector<std::vector<uint32_t>> workerCandidates; // Scratch: grid ids along a move, per worker
+    float sweepReach; // Sweep window padding: largest enemy radius + enemy move this tick
+    void queryBulletGrid(size_t bi, std::vector<uint32_t>& scratch, std::vector<DamageEvent>& out) const;
+    void queryBulletSweep(size_t bi, std::vector<DamageEvent>& out) const;
+    static void orderBulletHits(std::vector<DamageEvent>& out, size_t first, bool spentByFirst);
+    void queryBulletHits();
+    void resolveDamageEvents();
+    void buildSweepOrder();
+    void buildEnemyGrid();
+    SpatialGrid enemyGrid;
+    std::vector<Enemy*> sweepOrder; // Scratch: enemies sorted by Y for the sweep
+    std::vector<float> packedX, packedY, packedRadius; // Scratch: enemies packed for the player narrowphase
+    void hitPlayer(int damage);
+    void snapPreviousPositions();
+    void prewarmEnemies(size_t spawns);
+    void queueWaveFromTable(const WaveRecord& wave);
+    void queueWaveFromFormula();
+    void queueSpawn(float time, int type, float xOffset, int pattern, int hp, float speed);
     void spawnElite();
+    void fireEmitters(float deltaTime);
     void onEliteKilled();
 };
 
@@ -0,0 +1,13 @@
+// InputState.h
+#ifndef INPUTSTATE_H
+#define INPUTSTATE_H
+
+// Snapshot of the controls the simulation cares about for one update.
+// Filled from the keyboard by main.cpp, or by a policy in headless runs.
+struct InputState {
+    bool left = false;
+    bool right = false;
+    bool fire = false;
+};
+
+#endif
@@ -0,0 +1,120 @@
+// JobSystem.cpp
+#include "JobSystem.h"
+
+JobSystem::JobSystem(unsigned threads)
+    : current(nullptr), batch(0), stopping(false), remaining(0), stealCount(0) {
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+
+    for (unsigned i = 0; i < threads; ++i) {
+        queues.push_back(std::unique_ptr<Queue>(new Queue()));
+    }
+    for (unsigned i = 1; i < threads; ++i) {
+        this->threads.push_back(std::thread(&JobSystem::workerLoop, this, i));
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& t : threads) t.join();
+}
+
+void JobSystem::parallelFor(size_t count, size_t grain, const RangeFn& fn) {
+    if (count == 0) return;
+    if (grain == 0) grain = 1;
+
+    size_t jobCount = (count + grain - 1) / grain;
+    size_t workers = queues.size();
+
+    // Set before any job is visible: a worker still draining the previous
+    // batch may pick one up before it sees the wake-up
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        current = &fn;
+        remaining = jobCount;
+        ++batch;
+    }
+
+    // Contiguous blocks per worker; stealing evens out whatever this gets wrong
+    for (size_t w = 0; w < workers; ++w) {
+        size_t firstJob = jobCount * w / workers;
+        size_t lastJob = jobCount * (w + 1) / workers;
+        std::lock_guard<std::mutex> lock(queues[w]->mutex);
+        for (size_t j = firstJob; j < lastJob; ++j) {
+            size_t begin = j * grain;
+            size_t end = begin + grain < count ? begin + grain : count;
+            queues[w]->jobs.push_back(Job{ begin, end });
+        }
+    }
+
+    wake.notify_all();
+
+    while (runOne(0)) {}
+
+    std::unique_lock<std::mutex> lock(stateMutex);
+    finished.wait(lock, [this] { return remaining.load() == 0; });
+    current = nullptr;
+}
+
+void JobSystem::forEachChunk(JobSystem* jobs, size_t count, size_t grain, const RangeFn& fn) {
+    if (grain == 0) grain = 1;
+    if (jobs && jobs->workerCount() > 1 && count > grain) {
+        jobs->parallelFor(count, grain, fn);
+        return;
+    }
+    for (size_t begin = 0; begin < count; begin += grain) {
+        fn(begin, begin + grain < count ? begin + grain : count, 0);
+    }
+}
+
+bool JobSystem::runOne(unsigned id) {
+    Job job;
+    bool found = false;
+    {
+        Queue& own = *queues[id];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty()) {
+            job = own.jobs.back();
+            own.jobs.pop_back();
+            found = true;
+        }
+    }
+    for (size_t i = 1; !found && i < queues.size(); ++i) {
+        Queue& victim = *queues[(id + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            job = victim.jobs.front();
+            victim.jobs.pop_front();
+            found = true;
+            ++stealCount;
+        }
+    }
+    if (!found) return false;
+
+    (*current)(job.begin, job.end, id);
+
+    if (--remaining == 0) {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        finished.notify_all();
+    }
+    return true;
+}
+
+void JobSystem::workerLoop(unsigned id) {
+    unsigned long seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            wake.wait(lock, [&] { return stopping || batch != seen; });
+            if (stopping) return;
+            seen = batch;
+        }
+        // Jobs are only queued before a batch starts, so once every deque
+        // is empty this worker has nothing left to do until the next one.
+        while (runOne(id)) {}
+    }
+}
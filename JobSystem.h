@@ -0,0 +1,74 @@
+// JobSystem.h
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed pool of worker threads with one job deque per worker. A worker takes
+// jobs from the back of its own deque and, when that runs dry, steals from the
+// front of the others', so uneven jobs (games that last 10 s next to games
+// that last 10 min) still keep every core busy.
+//
+// The calling thread works as worker 0 while it waits, so JobSystem(1) runs
+// everything inline. Do not call parallelFor from inside a job.
+class JobSystem {
+public:
+    // Called with a half-open index range and the id of the worker running it
+    // (0..workerCount()-1), e.g. to pick per-worker scratch state.
+    typedef std::function<void(size_t begin, size_t end, unsigned worker)> RangeFn;
+
+    // threads: total workers including the caller; 0 = one per hardware thread
+    explicit JobSystem(unsigned threads = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    unsigned workerCount() const { return (unsigned)queues.size(); }
+
+    // Splits [0, count) into jobs of at most grain indices and blocks until
+    // all of them have run.
+    void parallelFor(size_t count, size_t grain, const RangeFn& fn);
+
+    size_t steals() const { return stealCount.load(); } // Jobs run by a worker other than their owner
+
+    // Same chunks as parallelFor, on jobs when there is one and more than one
+    // chunk, inline (worker 0) otherwise. Chunk boundaries never depend on the
+    // thread count, so per-chunk results merged in chunk order are identical
+    // however many workers ran them.
+    static void forEachChunk(JobSystem* jobs, size_t count, size_t grain, const RangeFn& fn);
+
+private:
+    struct Job {
+        size_t begin, end;
+    };
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> threads;
+
+    std::mutex stateMutex;
+    std::condition_variable wake;     // New batch (or shutdown) for the workers
+    std::condition_variable finished; // Last job of the batch done
+    const RangeFn* current;
+    unsigned long batch;              // Bumped per parallelFor
+    bool stopping;
+    std::atomic<size_t> remaining;
+    std::atomic<size_t> stealCount;
+
+    void workerLoop(unsigned id);
+    bool runOne(unsigned id);
+};
+
+#endif
@@ -0,0 +1,76 @@
+// Narrowphase.cpp
+#include "Narrowphase.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Squared distances against squared radii: no square roots. Lanes past count
+// are masked off before the first hit is picked.
+long firstPointInCircle(const float* xs, const float* ys, size_t count, float cx, float cy, float radius) {
+    const float r2 = radius * radius;
+    size_t i = 0;
+#if defined(__AVX__)
+    const __m256 cx8 = _mm256_set1_ps(cx), cy8 = _mm256_set1_ps(cy), r28 = _mm256_set1_ps(r2);
+    for (; i < count; i += 8) {
+        __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), cx8);
+        __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), cy8);
+        __m256 d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(d2, r28, _CMP_LT_OQ));
+        if (count - i < 8) mask &= (1 << (count - i)) - 1;
+        if (mask) return (long)(i + __builtin_ctz(mask));
+    }
+#elif defined(__SSE2__)
+    const __m128 cx4 = _mm_set1_ps(cx), cy4 = _mm_set1_ps(cy), r24 = _mm_set1_ps(r2);
+    for (; i < count; i += 4) {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + i), cx4);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + i), cy4);
+        __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        int mask = _mm_movemask_ps(_mm_cmplt_ps(d2, r24));
+        if (count - i < 4) mask &= (1 << (count - i)) - 1;
+        if (mask) return (long)(i + __builtin_ctz(mask));
+    }
+#else
+    for (; i < count; ++i) {
+        float dx = xs[i] - cx, dy = ys[i] - cy;
+        if (dx * dx + dy * dy < r2) return (long)i;
+    }
+#endif
+    return -1;
+}
+
+long firstCircleOverlap(const float* xs, const float* ys, const float* rs, size_t count,
+                        float cx, float cy, float radius) {
+    size_t i = 0;
+#if defined(__AVX__)
+    const __m256 cx8 = _mm256_set1_ps(cx), cy8 = _mm256_set1_ps(cy), r8 = _mm256_set1_ps(radius);
+    for (; i < count; i += 8) {
+        __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), cx8);
+        __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), cy8);
+        __m256 reach = _mm256_add_ps(_mm256_loadu_ps(rs + i), r8);
+        __m256 d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(d2, _mm256_mul_ps(reach, reach), _CMP_LT_OQ));
+        if (count - i < 8) mask &= (1 << (count - i)) - 1;
+        if (mask) return (long)(i + __builtin_ctz(mask));
+    }
+#elif defined(__SSE2__)
+    const __m128 cx4 = _mm_set1_ps(cx), cy4 = _mm_set1_ps(cy), r4 = _mm_set1_ps(radius);
+    for (; i < count; i += 4) {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + i), cx4);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + i), cy4);
+        __m128 reach = _mm_add_ps(_mm_loadu_ps(rs + i), r4);
+        __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        int mask = _mm_movemask_ps(_mm_cmplt_ps(d2, _mm_mul_ps(reach, reach)));
+        if (count - i < 4) mask &= (1 << (count - i)) - 1;
+        if (mask) return (long)(i + __builtin_ctz(mask));
+    }
+#else
+    for (; i < count; ++i) {
+        float dx = xs[i] - cx, dy = ys[i] - cy, reach = rs[i] + radius;
+        if (dx * dx + dy * dy < reach * reach) return (long)i;
+    }
+#endif
+    return -1;
+}
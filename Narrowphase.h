@@ -0,0 +1,54 @@
+// Narrowphase.h
+#ifndef NARROWPHASE_H
+#define NARROWPHASE_H
+
+#include <cstddef>
+#include <algorithm> // For std::swap, std::max, std::min
+
+// One circle against packed candidate positions, 8 (AVX) or 4 (SSE2) at a
+// time. Arrays must be readable up to count rounded up to 8 (AlignedArray
+// pads that far); the padding is never reported. Return the lowest index
+// that overlaps, or -1.
+
+// Candidates are points; radius is the circle's radius plus theirs.
+long firstPointInCircle(const float* xs, const float* ys, size_t count, float cx, float cy, float radius);
+
+// Candidates are circles of radii rs.
+long firstCircleOverlap(const float* xs, const float* ys, const float* rs, size_t count,
+                        float cx, float cy, float radius);
+
+// Continuous test for a point moving from (x0, y0) to (x1, y1) against the
+// open box |x - cx| < halfW, |y - cy| < halfH (slab method). On a hit, t is
+// the fraction of the move (0..1) at which the point is first inside.
+// Touching an edge is not a hit, same as the old end-position test.
+inline bool sweptPointInBox(float x0, float y0, float x1, float y1,
+                            float cx, float cy, float halfW, float halfH, float& t) {
+    float sx = x0 - cx, sy = y0 - cy;
+    float dx = x1 - x0, dy = y1 - y0;
+    // Most candidates miss: reject on the move's bounding box before any division
+    if (std::min(sx, sx + dx) >= halfW || std::max(sx, sx + dx) <= -halfW ||
+        std::min(sy, sy + dy) >= halfH || std::max(sy, sy + dy) <= -halfH) {
+        return false;
+    }
+
+    float tmin = 0.0f, tmax = 1.0f;
+    if (dx != 0.0f) {
+        float inv = 1.0f / dx;
+        float tEnter = (-halfW - sx) * inv, tExit = (halfW - sx) * inv;
+        if (tEnter > tExit) std::swap(tEnter, tExit);
+        tmin = std::max(tmin, tEnter);
+        tmax = std::min(tmax, tExit);
+    }
+    if (dy != 0.0f) {
+        float inv = 1.0f / dy;
+        float tEnter = (-halfH - sy) * inv, tExit = (halfH - sy) * inv;
+        if (tEnter > tExit) std::swap(tEnter, tExit);
+        tmin = std::max(tmin, tEnter);
+        tmax = std::min(tmax, tExit);
+    }
+    if (tmin >= tmax) return false;
+    t = tmin;
+    return true;
+}
+
+#endif
@@ -4,77 +4,257 @@
 
 #include <vector>
 #include <memory>
-#include <algorithm> // For std::find
+#include <cstdint>
+#include <cstddef>
+#include <new>
+
+// Stable reference to a pooled object. Survives the swap-remove done by
+// releaseAt (it names the slot, not the position in activeObjects) and goes
+// stale once the object is released: the slot's generation is bumped.
+struct PoolHandle {
+    uint32_t index;
+    uint32_t generation;
+
+    static PoolHandle invalid() { return PoolHandle{UINT32_MAX, 0}; }
+    bool isValid() const { return index != UINT32_MAX; }
+    bool operator==(const PoolHandle& o) const { return index == o.index && generation == o.generation; }
+    bool operator!=(const PoolHandle& o) const { return !(*this == o); }
+};
+
+// Counters for sizing pools from real runs.
+struct PoolStats {
+    size_t capacity = 0;  // Objects currently allocated
+    size_t highWater = 0; // Most objects active at once
+    size_t misses = 0;    // acquire() calls that returned nullptr
+    size_t growths = 0;   // Chunks added after construction
+};
+
+// Per-type hook that builds a spawn-ready object in place when a pool hands
+// out a slot, so nothing leaks from the slot's previous life (e.g. an enemy
+// that stayed elite). mem never holds a live object. The default
+// value-constructs T; specialize for types that need something else.
+template <typename T>
+struct PoolReset {
+    static T* apply(void* mem) { return ::new (mem) T(); }
+};
 
 template <typename T>
 class ObjectPool {
 private:
-    std::vector<std::unique_ptr<T>> pool;
-    std::vector<T*> freeObjects; // To quickly find inactive objects
-    size_t maxSize;
+    enum : uint32_t { NOT_ACTIVE = UINT32_MAX };
 
-public:
-    std::vector<T*> activeObjects; // Now public and persistent
+    // Objects live in fixed-size chunks that are never reallocated, so
+    // pointers to live objects stay valid when the pool grows.
+    std::vector<std::unique_ptr<T[]>> chunks;
+    size_t chunkSize;
+    bool growable;
 
-    ObjectPool(size_t size) : maxSize(size) {
-        pool.reserve(maxSize);
-        freeObjects.reserve(maxSize);
-        activeObjects.reserve(maxSize);
+    std::vector<T*> slotObjects;        // slot -> object
+    std::vector<uint32_t> generations;  // slot -> current generation
+    std::vector<uint32_t> activePos;    // slot -> index in activeObjects, or NOT_ACTIVE
+    std::vector<uint32_t> activeSlots;  // Parallel to activeObjects
+    std::vector<uint32_t> freeSlots;    // To quickly find inactive objects
+    PoolStats counters;
 
-        for (size_t i = 0; i < maxSize; ++i) {
-            pool.push_back(std::make_unique<T>());
-            freeObjects.push_back(pool.back().get()); // All objects are free initially
+    void addChunk() {
+        std::unique_ptr<T[]> chunk(new T[chunkSize]);
+        uint32_t first = (uint32_t)slotObjects.size();
+        for (size_t i = 0; i < chunkSize; ++i) {
+            slotObjects.push_back(&chunk[i]);
+            generations.push_back(0);
+            activePos.push_back(NOT_ACTIVE);
+        }
+        // Same hand-out order as before chunks existed: highest slot first
+        for (size_t i = 0; i < chunkSize; ++i) {
+            freeSlots.push_back(first + (uint32_t)i);
         }
-        // std::cout << "ObjectPool constructed. Size: " << maxSize << std::endl;
+        chunks.push_back(std::move(chunk));
+        counters.capacity = slotObjects.size();
     }
 
-    T* acquire() {
-        if (freeObjects.empty()) {
-            // std::cout << "ObjectPool acquire: No free objects!" << std::endl;
-            return nullptr; // No free objects available
+    // O(chunks): only release(T*) and handleOf(T*) need it.
+    uint32_t slotOf(const T* obj) const {
+        for (size_t c = 0; c < chunks.size(); ++c) {
+            const T* base = chunks[c].get();
+            if (obj >= base && obj < base + chunkSize) {
+                return (uint32_t)(c * chunkSize + (size_t)(obj - base));
+            }
         }
+        return NOT_ACTIVE;
+    }
 
-        T* obj = freeObjects.back();
-        freeObjects.pop_back();
+    // Pops a free slot (growing if allowed), or NOT_ACTIVE and a miss.
+    uint32_t takeSlot(PoolHandle* outHandle) {
+        if (freeSlots.empty()) {
+            if (!growable) {
+                counters.misses++;
+                if (outHandle) *outHandle = PoolHandle::invalid();
+                return NOT_ACTIVE;
+            }
+            addChunk();
+            counters.growths++;
+        }
+        uint32_t slot = freeSlots.back();
+        freeSlots.pop_back();
+        return slot;
+    }
 
+    T* activate(uint32_t slot, T* obj, PoolHandle* outHandle) {
         obj->active = true;
+        activePos[slot] = (uint32_t)activeObjects.size();
         activeObjects.push_back(obj);
-        // std::cout << "ObjectPool acquire: " << obj << " (active objects: " << activeObjects.size() << ", free objects: " << freeObjects.size() << ")" << std::endl;
+        activeSlots.push_back(slot);
+        if (activeObjects.size() > counters.highWater) counters.highWater = activeObjects.size();
+
+        if (outHandle) *outHandle = PoolHandle{slot, generations[slot]};
         return obj;
     }
 
-    void release(T* obj) { // This method is not used, releaseAt is.
+    void releaseSlot(uint32_t slot) {
+        uint32_t index = activePos[slot];
+        T* obj = slotObjects[slot];
         obj->active = false;
-        // Find and remove from activeObjects using swap-remove
-        // This is O(N) in worst case, but average is better
-        for (size_t i = 0; i < activeObjects.size(); ++i) {
-            if (activeObjects[i] == obj) {
-                activeObjects[i] = activeObjects.back();
-                activeObjects.pop_back();
-                break;
-            }
+
+        // Swap-remove from activeObjects, keeping the moved slot's position current
+        uint32_t lastSlot = activeSlots.back();
+        activeObjects[index] = activeObjects.back();
+        activeSlots[index] = lastSlot;
+        activePos[lastSlot] = index;
+        activeObjects.pop_back();
+        activeSlots.pop_back();
+
+        activePos[slot] = NOT_ACTIVE;
+        generations[slot]++; // Outstanding handles to this object go stale
+        freeSlots.push_back(slot); // Add back to free list
+    }
+
+public:
+    // Live objects in no particular order. Public for fast iteration; add and
+    // remove only through the pool (and do not reorder it: sort a copy).
+    std::vector<T*> activeObjects;
+
+    // size: objects allocated up front (also the chunk size when growing).
+    // pgrowable: when exhausted, add another chunk instead of returning nullptr.
+    explicit ObjectPool(size_t size, bool pgrowable = false)
+        : chunkSize(size > 0 ? size : 1), growable(pgrowable) {
+        slotObjects.reserve(chunkSize);
+        generations.reserve(chunkSize);
+        activePos.reserve(chunkSize);
+        activeSlots.reserve(chunkSize);
+        freeSlots.reserve(chunkSize);
+        activeObjects.reserve(chunkSize);
+        addChunk();
+    }
+
+    void setGrowable(bool pgrowable) { growable = pgrowable; }
+    bool isGrowable() const { return growable; }
+    const PoolStats& stats() const { return counters; }
+    size_t capacity() const { return slotObjects.size(); }
+
+    T* acquire(PoolHandle* outHandle = nullptr) {
+        uint32_t slot = takeSlot(outHandle);
+        if (slot == NOT_ACTIVE) return nullptr; // No free objects available
+
+        T* obj = slotObjects[slot];
+        obj->~T();
+        PoolReset<T>::apply(obj); // Fresh state: recycled objects keep nothing
+        return activate(slot, obj, outHandle);
+    }
+
+    // Like acquire(), but the object starts as a copy of prototype: one copy
+    // instead of a reset followed by field-by-field setup.
+    T* acquireCopy(const T& prototype, PoolHandle* outHandle = nullptr) {
+        uint32_t slot = takeSlot(outHandle);
+        if (slot == NOT_ACTIVE) return nullptr;
+
+        T* obj = slotObjects[slot];
+        obj->~T();
+        ::new (obj) T(prototype);
+        return activate(slot, obj, outHandle);
+    }
+
+    // Grows (if needed) so that n objects can be active without allocating
+    // later; counted in stats().growths. A fixed pool keeps its capacity: the
+    // shortfall shows up as misses when those acquires happen.
+    void reserve(size_t n) {
+        if (!growable) return;
+        while (slotObjects.size() < n) {
+            addChunk();
+            counters.growths++;
+        }
+    }
+
+    // Bulk acquire (e.g. a whole spread volley). Writes up to n objects to out
+    // and returns how many were acquired: n unless the pool is full and fixed.
+    size_t acquireN(size_t n, T** out, PoolHandle* outHandles = nullptr) {
+        size_t got = 0;
+        for (; got < n; ++got) {
+            T* obj = acquire(outHandles ? &outHandles[got] : nullptr);
+            if (!obj) break;
+            out[got] = obj;
+        }
+        return got;
+    }
+
+    // Releases every object at once (outstanding handles go stale) and refills
+    // the free list in slot order. Keeps capacity and stats.
+    void releaseAll() {
+        for (uint32_t slot : activeSlots) {
+            slotObjects[slot]->active = false;
+            activePos[slot] = NOT_ACTIVE;
+            generations[slot]++;
+        }
+        activeObjects.clear();
+        activeSlots.clear();
+        freeSlots.clear();
+        for (uint32_t slot = 0; slot < (uint32_t)slotObjects.size(); ++slot) {
+            freeSlots.push_back(slot);
         }
-        freeObjects.push_back(obj); // Add back to free list
-        // std::cout << "ObjectPool release (by obj): " << obj << " (active objects: " << activeObjects.size() << ", free objects: " << freeObjects.size() << ")" << std::endl;
     }
 
-    // New method for efficient release by index, to be used with iterators in GameState
+    // O(1); returns false for stale or invalid handles.
+    bool release(PoolHandle handle) {
+        if (!isAlive(handle)) return false;
+        releaseSlot(handle.index);
+        return true;
+    }
+
+    void release(T* obj) {
+        uint32_t slot = slotOf(obj);
+        if (slot == NOT_ACTIVE || activePos[slot] == NOT_ACTIVE) return;
+        releaseSlot(slot);
+    }
+
+    // Efficient release by index, to be used while iterating activeObjects.
+    // The last active object is moved into index.
     void releaseAt(size_t index) {
         if (index >= activeObjects.size()) {
-            // std::cout << "ObjectPool releaseAt: ERROR - invalid index " << index << " (size: " << activeObjects.size() << ")" << std::endl;
             return;
         }
+        releaseSlot(activeSlots[index]);
+    }
 
-        T* objToRelease = activeObjects[index];
-        objToRelease->active = false;
+    bool isAlive(PoolHandle handle) const {
+        return handle.index < slotObjects.size()
+            && generations[handle.index] == handle.generation
+            && activePos[handle.index] != NOT_ACTIVE;
+    }
 
-        // Swap-remove from activeObjects
-        activeObjects[index] = activeObjects.back();
-        activeObjects.pop_back();
+    // nullptr when the handle is stale.
+    T* get(PoolHandle handle) const {
+        return isAlive(handle) ? slotObjects[handle.index] : nullptr;
+    }
+
+    PoolHandle handleAt(size_t index) const {
+        uint32_t slot = activeSlots[index];
+        return PoolHandle{slot, generations[slot]};
+    }
 
-        freeObjects.push_back(objToRelease); // Add back to free list
-        // std::cout << "ObjectPool releaseAt: " << objToRelease << " at index " << index << " (active objects: " << activeObjects.size() << ", free objects: " << freeObjects.size() << ")" << std::endl;
+    PoolHandle handleOf(const T* obj) const {
+        uint32_t slot = slotOf(obj);
+        if (slot == NOT_ACTIVE || activePos[slot] == NOT_ACTIVE) return PoolHandle::invalid();
+        return PoolHandle{slot, generations[slot]};
     }
 };
 
-#endif
\ No newline at end of file
+#endif
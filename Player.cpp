@@ -1,13 +1,12 @@
 // Player.cpp
 #include "Player.h"
-#include "ObjectPool.h"
 #include "GameState.h" // Now needed for the GameState& parameters
 #include <cmath>
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
-Player::Player() : x(400.0f), y(550.0f), hp(100), fireRate(10), currentDX(0.0f), shootCooldown(0.0f), baseDamage(10), shotsFired(0), hasOverheat(false), hasShatter(false), hasExecute(false),
+Player::Player() : x(400.0f), y(550.0f), prevX(400.0f), hp(100), invulnerableTimer(0.0f), fireRate(10), currentDX(0.0f), shootCooldown(0.0f), baseDamage(10), shotsFired(0), hasOverheat(false), hasShatter(false), hasExecute(false),
     upgrades{
         {UpgradeTag::DAMAGE, 0},
         {UpgradeTag::FIRERATE, 0},
@@ -24,7 +23,7 @@ void Player::move(float dx) {
     currentDX = dx;
 }
 
-void Player::shoot(ObjectPool<Bullet>& bulletPool, GameState& gs) {
+void Player::shoot(BulletStore& bullets, GameState& gs) {
     if (shootCooldown > 0.0f) return;
 
     shootCooldown = 1.0f / fireRate;
@@ -45,43 +44,28 @@ void Player::shoot(ObjectPool<Bullet>& bulletPool, GameState& gs) {
         int center = spreadAmount / 2;
         for (int i = 0; i < spreadAmount; ++i) {
             float angle = baseAngle + (i - center) * angleStep;
-            Bullet* b = bulletPool.acquire();
-            if (b) {
-                b->x = x;
-                b->y = y;
-                b->vx = cosf(angle) * bulletSpeed;
-                b->vy = sinf(angle) * bulletSpeed;
-                b->damage = baseDamage;
-                b->isPlayerOwned = true;
-                b->active = true;
-                b->toDestroy = false;
-                b->pierce = upgrades[UpgradeTag::PIERCE];
-            }
+            bullets.spawn(x, y, cosf(angle) * bulletSpeed, sinf(angle) * bulletSpeed,
+                          baseDamage, upgrades[UpgradeTag::PIERCE], BULLET_LASER, true);
         }
     } else {
-        Bullet* b = bulletPool.acquire();
-        if (b) {
-            b->x = x;
-            b->y = y;
-            b->vx = cosf(baseAngle) * bulletSpeed;
-            b->vy = sinf(baseAngle) * bulletSpeed;
-            b->damage = baseDamage;
-            b->isPlayerOwned = true;
-            b->active = true;
-            b->toDestroy = false;
-            b->pierce = upgrades[UpgradeTag::PIERCE];
-        }
+        bullets.spawn(x, y, cosf(baseAngle) * bulletSpeed, sinf(baseAngle) * bulletSpeed,
+                      baseDamage, upgrades[UpgradeTag::PIERCE], BULLET_LASER, true);
     }
 }
 
-void Player::update(float deltaTime) {
+void Player::update(float deltaTime, float worldWidth) {
+    prevX = x;
     x += currentDX * deltaTime;
     if (x < 0) x = 0;
-    if (x > GameState::SCREEN_WIDTH) x = GameState::SCREEN_WIDTH;
+    if (x > worldWidth) x = worldWidth;
 
     if (shootCooldown > 0) {
         shootCooldown -= deltaTime;
     }
+    if (invulnerableTimer > 0) {
+        invulnerableTimer -= deltaTime;
+        if (invulnerableTimer < 0) invulnerableTimer = 0;
+    }
 }
 
 void Player::applyUpgrade(const Upgrade& upgrade) {
@@ -91,15 +75,12 @@ void Player::applyUpgrade(const Upgrade& upgrade) {
     }
 }
 
-void Player::takeDamage(int damage) {
+bool Player::takeDamage(int damage) {
+    if (isInvulnerable()) return false;
     hp -= damage;
     if (hp < 0) hp = 0;
-}
-
-void Player::render(SDL_Renderer* renderer) {
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-    SDL_Rect playerRect = {static_cast<int>(x - 10), static_cast<int>(y - 10), 20, 20};
-    SDL_RenderFillRect(renderer, &playerRect);
+    invulnerableTimer = INVULNERABLE_TIME;
+    return true;
 }
 
 void Player::addUpgrade(UpgradeTag tag, GameState& gs) {
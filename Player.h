@@ -6,8 +6,7 @@
 #include <unordered_map>
 #include "Bullet.h"
 #include "Upgrade.h"
-#include "ObjectPool.h" // Include ObjectPool for the shoot method
-#include <SDL2/SDL.h> // Include SDL for SDL_Renderer
+#include "BulletStore.h" // Bullets are spawned straight into the store
 
 class GameState; // Forward declaration
 
@@ -22,8 +21,12 @@ enum class UpgradeTag {
 
 class Player {
 public:
+    static constexpr float HIT_RADIUS = 8.0f;        // Hitbox circle, smaller than the sprite
+    static constexpr float INVULNERABLE_TIME = 1.0f; // Iframes after taking damage
     float x, y;
+    float prevX; // x at the start of the last update (render interpolation)
     int hp;
+    float invulnerableTimer; // Seconds of iframes left after a hit
     int fireRate;
     std::vector<Upgrade> activeUpgrades;
     float currentDX; // Stores player's intended movement direction
@@ -40,11 +43,11 @@ public:
 
     Player();
     void move(float dx);
-    void shoot(ObjectPool<Bullet>& bulletPool, GameState& gs);
-    void update(float deltaTime); // Added update method
+    void shoot(BulletStore& bullets, GameState& gs);
+    void update(float deltaTime, float worldWidth); // Moves within [0, worldWidth], ticks cooldowns
     void applyUpgrade(const Upgrade& upgrade);
-    void takeDamage(int damage);
-    void render(SDL_Renderer* renderer); // Added render method
+    bool takeDamage(int damage); // False while invulnerable (no damage taken)
+    bool isInvulnerable() const { return invulnerableTimer > 0.0f; }
 
     void addUpgrade(UpgradeTag tag, GameState& gs);
     void checkSynergies(GameState& gs);
@@ -0,0 +1,81 @@
+// Profiler.cpp
+#include "Profiler.h"
+#include <cstdio>
+#include <cstring>
+
+static const char* const PHASE_NAMES[PHASE_COUNT] = {
+    "spawn", "enemies", "bullets", "emitters", "broadphase", "collision", "hit_resolve", "player_hits", "damage_numbers", "wave",
+    "render_background", "render_enemies", "render_bullets", "render_submit", "render_numbers"
+};
+
+const char* profilePhaseName(ProfilePhase phase) {
+    return (phase >= 0 && phase < PHASE_COUNT) ? PHASE_NAMES[phase] : "?";
+}
+
+Profiler::Profiler(size_t frameCapacity)
+    : frames(frameCapacity > 0 ? frameCapacity : 1), next(0), count(0), total(0) {
+    memset(&current, 0, sizeof(current));
+    frameStart = Clock::now();
+}
+
+void Profiler::beginFrame() {
+    memset(&current, 0, sizeof(current));
+    frameStart = Clock::now();
+}
+
+void Profiler::setCounts(size_t enemies, size_t bullets) {
+    current.enemies = (uint32_t)enemies;
+    current.bullets = (uint32_t)bullets;
+}
+
+void Profiler::endFrame() {
+    current.totalMs = (float)(std::chrono::duration<double>(Clock::now() - frameStart).count() * 1000.0);
+    frames[next] = current;
+    next = (next + 1) % frames.size();
+    if (count < frames.size()) count++;
+    total++;
+}
+
+const Profiler::Frame& Profiler::frame(size_t age) const {
+    return frames[(next + frames.size() - 1 - age) % frames.size()];
+}
+
+Profiler::Frame Profiler::average(size_t n) const {
+    Frame avg;
+    memset(&avg, 0, sizeof(avg));
+    if (n > count) n = count;
+    if (n == 0) return avg;
+
+    double sums[PHASE_COUNT] = {};
+    double totalMs = 0.0, enemies = 0.0, bullets = 0.0;
+    for (size_t age = 0; age < n; ++age) {
+        const Frame& f = frame(age);
+        for (int p = 0; p < PHASE_COUNT; ++p) sums[p] += f.ms[p];
+        totalMs += f.totalMs;
+        enemies += f.enemies;
+        bullets += f.bullets;
+    }
+    for (int p = 0; p < PHASE_COUNT; ++p) avg.ms[p] = (float)(sums[p] / n);
+    avg.totalMs = (float)(totalMs / n);
+    avg.enemies = (uint32_t)(enemies / n + 0.5);
+    avg.bullets = (uint32_t)(bullets / n + 0.5);
+    return avg;
+}
+
+bool Profiler::writeCsv(const char* path) const {
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+
+    fprintf(f, "frame,total_ms");
+    for (int p = 0; p < PHASE_COUNT; ++p) fprintf(f, ",%s_ms", PHASE_NAMES[p]);
+    fprintf(f, ",enemies,bullets\n");
+
+    uint64_t firstFrame = total - count;
+    for (size_t i = 0; i < count; ++i) {
+        const Frame& fr = frame(count - 1 - i);
+        fprintf(f, "%llu,%.4f", (unsigned long long)(firstFrame + i), fr.totalMs);
+        for (int p = 0; p < PHASE_COUNT; ++p) fprintf(f, ",%.4f", fr.ms[p]);
+        fprintf(f, ",%u,%u\n", fr.enemies, fr.bullets);
+    }
+    return fclose(f) == 0;
+}
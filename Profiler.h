@@ -0,0 +1,100 @@
+// Profiler.h
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Phases timed by PROFILE_SCOPE. Simulation phases add up over every tick run
+// in a frame; render phases are timed once per frame.
+enum ProfilePhase {
+    PHASE_SPAWN = 0,
+    PHASE_ENEMIES,
+    PHASE_BULLETS,
+    PHASE_EMITTERS,      // Enemy volleys and enemy bullet movement
+    PHASE_BROADPHASE,    // Y-sort (sweep) or grid build
+    PHASE_COLLISION,     // Bullet -> enemy queries, emitting damage events
+    PHASE_HIT_RESOLVE,   // Damage events -> hp, kills, synergies, juice
+    PHASE_PLAYER_HITS,   // Enemies and enemy bullets -> player
+    PHASE_DAMAGE_NUMBERS,
+    PHASE_WAVE,
+    PHASE_RENDER_BACKGROUND,
+    PHASE_RENDER_ENEMIES, // Includes the player
+    PHASE_RENDER_BULLETS,
+    PHASE_RENDER_SUBMIT,  // Entity batch flush
+    PHASE_RENDER_NUMBERS,
+    PHASE_COUNT
+};
+
+const char* profilePhaseName(ProfilePhase phase);
+
+// Fixed ring of the most recent frames' per-phase times and entity counts.
+// Recording never allocates; the oldest frame is overwritten.
+class Profiler {
+public:
+    struct Frame {
+        float ms[PHASE_COUNT];
+        float totalMs; // beginFrame() to endFrame()
+        uint32_t enemies;
+        uint32_t bullets;
+    };
+
+    explicit Profiler(size_t frameCapacity = 600);
+
+    void beginFrame();
+    void add(ProfilePhase phase, double seconds) { current.ms[phase] += (float)(seconds * 1000.0); }
+    void setCounts(size_t enemies, size_t bullets);
+    void endFrame();
+
+    size_t size() const { return count; }            // Frames held
+    uint64_t framesRecorded() const { return total; } // Frames ever finished
+    const Frame& frame(size_t age) const;            // 0 = latest finished frame
+    Frame average(size_t frames) const;              // Over the latest frames (at most size())
+
+    // One row per held frame, oldest first
+    bool writeCsv(const char* path) const;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    std::vector<Frame> frames;
+    size_t next;
+    size_t count;
+    uint64_t total;
+    Frame current;
+    Clock::time_point frameStart;
+};
+
+// Adds the lifetime of the scope to a phase. A null profiler costs one branch.
+class ProfileScope {
+public:
+    ProfileScope(Profiler* pprofiler, ProfilePhase pphase) : profiler(pprofiler), phase(pphase) {
+        if (profiler) start = std::chrono::steady_clock::now();
+    }
+    ~ProfileScope() {
+        if (profiler) {
+            profiler->add(phase, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+    }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    Profiler* profiler;
+    ProfilePhase phase;
+    std::chrono::steady_clock::time_point start;
+};
+
+// Build with -DNO_PROFILER (make PROFILEFLAGS=-DNO_PROFILER) to compile every
+// timer out; the Profiler then just records empty frames.
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#ifdef NO_PROFILER
+#define PROFILE_SCOPE(profiler, phase) ((void)0)
+#else
+#define PROFILE_SCOPE(profiler, phase) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(profiler, phase)
+#endif
+
+#endif
@@ -0,0 +1,61 @@
+// Random.h
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+// xoshiro128** generator. Small, fast and lock-free, unlike rand(), and each
+// instance is independent: every GameState owns its own streams, so runs are
+// reproducible from the seed and can execute side by side on different threads.
+class Random {
+public:
+    // Different stream ids from the same seed give unrelated sequences
+    explicit Random(uint32_t seed = 1, uint32_t stream = 0) { reseed(seed, stream); }
+
+    void reseed(uint32_t seed, uint32_t stream = 0) {
+        // splitmix64 spreads the seed over the whole state (never all zero)
+        uint64_t x = ((uint64_t)stream << 32) | seed;
+        for (int i = 0; i < 4; i += 2) {
+            uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            z ^= z >> 31;
+            s[i] = (uint32_t)z;
+            s[i + 1] = (uint32_t)(z >> 32);
+        }
+    }
+
+    uint32_t next() {
+        uint32_t result = rotl(s[1] * 5, 7) * 9;
+        uint32_t t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 11);
+        return result;
+    }
+
+    // Uniform in [0, bound) (multiply-shift, no division)
+    uint32_t nextInt(uint32_t bound) {
+        return (uint32_t)(((uint64_t)next() * bound) >> 32);
+    }
+
+    // Uniform in [lo, hi]
+    int range(int lo, int hi) {
+        return lo + (int)nextInt((uint32_t)(hi - lo + 1));
+    }
+
+    // Uniform in [0, 1)
+    float nextFloat() {
+        return (next() >> 8) * (1.0f / 16777216.0f);
+    }
+
+private:
+    uint32_t s[4];
+
+    static uint32_t rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+};
+
+#endif
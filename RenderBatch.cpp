@@ -0,0 +1,126 @@
+// RenderBatch.cpp
+#include "RenderBatch.h"
+#include <algorithm> // For std::stable_sort
+#include <cmath>     // For sqrtf
+
+RenderBatch::RenderBatch() : blendMode(SDL_BLENDMODE_NONE), drawCalls(0) {}
+
+void RenderBatch::setBlendMode(SDL_BlendMode mode) {
+    blendMode = mode;
+}
+
+void RenderBatch::fillRect(const SDL_Rect& rect, SDL_Color color) {
+    if (runs.empty() || runs.back().mode != blendMode) runs.push_back(Run{blendMode, commands.size()});
+    commands.push_back(Command{CMD_RECT, color, rect.x, rect.y, rect.w, rect.h});
+}
+
+void RenderBatch::line(int x1, int y1, int x2, int y2, SDL_Color color) {
+    if (runs.empty() || runs.back().mode != blendMode) runs.push_back(Run{blendMode, commands.size()});
+    commands.push_back(Command{CMD_LINE, color, x1, y1, x2, y2});
+}
+
+void RenderBatch::flush(SDL_Renderer* renderer) {
+    drawCalls = 0;
+    for (size_t r = 0; r < runs.size(); ++r) {
+        size_t end = (r + 1 < runs.size()) ? runs[r + 1].first : commands.size();
+        SDL_SetRenderDrawBlendMode(renderer, runs[r].mode);
+        flushRun(renderer, runs[r], end);
+    }
+    commands.clear();
+    runs.clear();
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+void RenderBatch::appendQuad(const SDL_FPoint (&corners)[4], SDL_Color color) {
+    int base = (int)vertices.size();
+    for (const SDL_FPoint& p : corners) {
+        SDL_Vertex v;
+        v.position = p;
+        v.color = color;
+        v.tex_coord = SDL_FPoint{0.0f, 0.0f};
+        vertices.push_back(v);
+    }
+    const int quad[6] = {0, 1, 2, 0, 2, 3};
+    for (int q : quad) indices.push_back(base + q);
+}
+
+// Every primitive becomes a colored quad; the whole run is one draw call.
+void RenderBatch::flushRun(SDL_Renderer* renderer, const Run& run, size_t end) {
+    vertices.clear();
+    indices.clear();
+
+    for (size_t i = run.first; i < end; ++i) {
+        const Command& cmd = commands[i];
+        if (cmd.kind == CMD_RECT) {
+            float x0 = (float)cmd.a, y0 = (float)cmd.b;
+            float x1 = x0 + cmd.c, y1 = y0 + cmd.d;
+            const SDL_FPoint corners[4] = {{x0, y0}, {x1, y0}, {x1, y1}, {x0, y1}};
+            appendQuad(corners, cmd.color);
+        } else {
+            // 1px-wide quad centered on the pixel centers, like SDL_RenderDrawLine
+            float x0 = cmd.a + 0.5f, y0 = cmd.b + 0.5f;
+            float x1 = cmd.c + 0.5f, y1 = cmd.d + 0.5f;
+            float dx = x1 - x0, dy = y1 - y0;
+            float len = sqrtf(dx * dx + dy * dy);
+            float nx = 0.5f, ny = 0.0f;
+            float ex = 0.0f, ey = 0.5f;
+            if (len > 0.0001f) {
+                nx = -dy / len * 0.5f;
+                ny = dx / len * 0.5f;
+                ex = dx / len * 0.5f; // Extend half a pixel past each end point
+                ey = dy / len * 0.5f;
+            }
+            const SDL_FPoint corners[4] = {
+                {x0 - ex + nx, y0 - ey + ny}, {x1 + ex + nx, y1 + ey + ny},
+                {x1 + ex - nx, y1 + ey - ny}, {x0 - ex - nx, y0 - ey - ny}
+            };
+            appendQuad(corners, cmd.color);
+        }
+    }
+
+    if (!indices.empty()) {
+        SDL_RenderGeometry(renderer, nullptr, vertices.data(), (int)vertices.size(), indices.data(), (int)indices.size());
+        drawCalls++;
+    }
+}
+
+#else
+
+static Uint32 packColor(SDL_Color c) {
+    return ((Uint32)c.r << 24) | ((Uint32)c.g << 16) | ((Uint32)c.b << 8) | c.a;
+}
+
+// No geometry API: group the run by color so each color costs one state
+// change and all its rects go out in a single SDL_RenderFillRects.
+void RenderBatch::flushRun(SDL_Renderer* renderer, const Run& run, size_t end) {
+    sorted.assign(commands.begin() + run.first, commands.begin() + end);
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Command& a, const Command& b) {
+        return packColor(a.color) < packColor(b.color);
+    });
+
+    size_t i = 0;
+    while (i < sorted.size()) {
+        SDL_Color color = sorted[i].color;
+        Uint32 key = packColor(color);
+        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+        drawCalls++;
+
+        sameColor.clear();
+        for (; i < sorted.size() && packColor(sorted[i].color) == key; ++i) {
+            const Command& cmd = sorted[i];
+            if (cmd.kind == CMD_RECT) {
+                sameColor.push_back(SDL_Rect{cmd.a, cmd.b, cmd.c, cmd.d});
+            } else {
+                SDL_RenderDrawLine(renderer, cmd.a, cmd.b, cmd.c, cmd.d);
+                drawCalls++;
+            }
+        }
+        if (!sameColor.empty()) {
+            SDL_RenderFillRects(renderer, sameColor.data(), (int)sameColor.size());
+            drawCalls++;
+        }
+    }
+}
+
+#endif
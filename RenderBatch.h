@@ -0,0 +1,59 @@
+// RenderBatch.h
+#ifndef RENDERBATCH_H
+#define RENDERBATCH_H
+
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <vector>
+
+// Collects untextured rects and lines for a frame and submits them in as few
+// renderer calls as possible: one SDL_RenderGeometry per blend-mode run when
+// the SDL headers have it (2.0.18+), otherwise one SDL_RenderFillRects per
+// rect color plus one color change per line color.
+class RenderBatch {
+public:
+    RenderBatch();
+
+    // Later primitives use this blend mode (a change starts a new run).
+    void setBlendMode(SDL_BlendMode mode);
+
+    void fillRect(const SDL_Rect& rect, SDL_Color color);
+    void line(int x1, int y1, int x2, int y2, SDL_Color color);
+
+    // Draws everything queued and empties the batch. The geometry path keeps
+    // submission order; the fallback groups by color inside each run.
+    void flush(SDL_Renderer* renderer);
+
+    int lastDrawCalls() const { return drawCalls; } // Renderer calls made by the last flush
+    size_t pending() const { return commands.size(); }
+
+private:
+    enum Kind { CMD_RECT, CMD_LINE };
+    struct Command {
+        Kind kind;
+        SDL_Color color;
+        int a, b, c, d; // Rect: x, y, w, h. Line: x1, y1, x2, y2.
+    };
+    struct Run {
+        SDL_BlendMode mode;
+        size_t first; // Index of the run's first command; ends where the next run starts
+    };
+
+    std::vector<Command> commands;
+    std::vector<Run> runs;
+    SDL_BlendMode blendMode;
+    int drawCalls;
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    void appendQuad(const SDL_FPoint (&corners)[4], SDL_Color color);
+#else
+    std::vector<Command> sorted;
+    std::vector<SDL_Rect> sameColor;
+#endif
+
+    void flushRun(SDL_Renderer* renderer, const Run& run, size_t end);
+};
+
+#endif
@@ -0,0 +1,60 @@
+// RenderSnapshot.cpp
+#include "RenderSnapshot.h"
+#include "GameState.h"
+
+// Sized up front and written by index: no capacity check per bullet
+static void captureBullets(const BulletStore& store, std::vector<RenderSnapshot::BulletSprite>& out) {
+    out.resize(store.size());
+    size_t kept = 0;
+    for (size_t i = 0; i < store.size(); ++i) {
+        if (store.isDestroyed(i)) continue; // Spent on a hit this tick
+        RenderSnapshot::BulletSprite& b = out[kept++];
+        b.x = store.x[i];
+        b.y = store.y[i];
+        b.prevX = store.prevX[i];
+        b.prevY = store.prevY[i];
+        b.vx = store.vx[i];
+        b.vy = store.vy[i];
+        b.wavePhase = store.wavePhase[i];
+        b.type = store.type[i];
+    }
+    out.resize(kept);
+}
+
+void RenderSnapshot::capture(GameState& gs) {
+    player = PlayerSprite{ gs.player.x, gs.player.prevX, gs.player.y, gs.player.invulnerableTimer };
+
+    enemies.clear();
+    for (const Enemy* e : gs.enemyPool.activeObjects) {
+        if (!e->active) continue;
+        float hpRatio = e->maxHp > 0 ? (float)e->hp / e->maxHp : 0.0f;
+        if (hpRatio < 0.0f) hpRatio = 0.0f;
+        if (hpRatio > 1.0f) hpRatio = 1.0f;
+        enemies.push_back(EnemySprite{ e->x, e->y, e->prevX, e->prevY, e->radius, e->pulsePhase, hpRatio,
+                                       e->hitTimer, e->type });
+    }
+
+    captureBullets(gs.bullets, bullets);
+    captureBullets(gs.enemyBullets, enemyBullets);
+
+    damageNumbers.clear();
+    const DamageNumberBuffer& numbers = gs.damageNumbers;
+    for (size_t i = 0; i < numbers.size(); ++i) {
+        const DamageNumber& dn = numbers[i];
+        damageNumbers.push_back(NumberSprite{ dn.x, dn.y, dn.life, dn.value, dn.critical });
+    }
+
+    // SCREEN SHAKE OFFSET
+    shakeX = 0;
+    shakeY = 0;
+    float totalShake = gs.screenShake + gs.impactShake; // Combine screenShake and impactShake
+    if (totalShake > 0.1f) {
+        int shakeAmount = (int)(totalShake * 2);
+        if (shakeAmount < 1) shakeAmount = 1; // Ensure shakeAmount is at least 1
+        shakeX = (int)gs.cosmeticRng.nextInt(shakeAmount) - (shakeAmount / 2); // Center around zero
+        shakeY = (int)gs.cosmeticRng.nextInt(shakeAmount) - (shakeAmount / 2); // Center around zero
+    }
+
+    currentWave = gs.currentWave;
+    isGameOver = gs.isGameOver;
+}
@@ -0,0 +1,59 @@
+// RenderSnapshot.h
+#ifndef RENDERSNAPSHOT_H
+#define RENDERSNAPSHOT_H
+
+#include <vector>
+#include <cstdint>
+#include "Profiler.h"
+
+class GameState;
+
+// Everything GameRenderer draws, copied out of a GameState after a tick.
+// Once captured it does not refer back to the game, so it can be drawn on
+// another thread while the simulation keeps running (main.cpp --sim-thread
+// hands them over through a TripleBuffer). Capturing again reuses the
+// vectors' allocations.
+struct RenderSnapshot {
+    struct PlayerSprite {
+        float x, prevX, y;
+        float invulnerableTimer; // Blinks while > 0
+    };
+    struct EnemySprite {
+        float x, y, prevX, prevY;
+        float radius;
+        float pulsePhase;
+        float hpRatio;  // hp / maxHp, clamped to [0,1]
+        float hitTimer; // Hit flash left
+        int type;
+    };
+    struct BulletSprite {
+        float x, y, prevX, prevY;
+        float vx, vy;    // Trail direction
+        float wavePhase; // Plasma wobble
+        uint8_t type;    // BulletType
+    };
+    struct NumberSprite {
+        float x, y;
+        float life;
+        int value;
+        bool critical;
+    };
+
+    PlayerSprite player = {};
+    std::vector<EnemySprite> enemies;       // Active ones, pool order
+    std::vector<BulletSprite> bullets;      // Player's, not yet spent
+    std::vector<BulletSprite> enemyBullets;
+    std::vector<NumberSprite> damageNumbers; // Oldest first
+    int shakeX = 0, shakeY = 0; // Viewport offset from screen shake
+    int currentWave = 0;
+    bool isGameOver = false;
+
+    // Filled by whoever runs the simulation, not by capture()
+    double tickTime = 0.0;          // When the latest tick was due, seconds on a steady clock
+    Profiler::Frame simTiming = {}; // Update phases of the latest tick (--sim-thread)
+
+    // Copies gs. The shake offset is rolled here, from gs.cosmeticRng.
+    void capture(GameState& gs);
+};
+
+#endif
@@ -0,0 +1,118 @@
+// Replay.cpp
+#include "Replay.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+const char MAGIC[4] = { 'W', 'S', 'R', 'P' };
+const uint32_t VERSION = 4; // 2: per-GameState Random instead of rand(); 3: bullets collide on their way out;
+                            // 4: hits at equal t ordered by enemy spawn order
+
+struct ReplayFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t seed;
+    float tickSeconds;
+    int32_t collisionMode;
+    uint32_t tickCount;
+    uint32_t runCount;
+};
+
+struct InputRun {
+    uint8_t bits;
+    uint16_t count;
+};
+
+} // namespace
+
+uint8_t Replay::pack(const InputState& input) {
+    return (uint8_t)((input.left ? 1 : 0) | (input.right ? 2 : 0) | (input.fire ? 4 : 0));
+}
+
+InputState Replay::unpack(uint8_t bits) {
+    InputState input;
+    input.left = (bits & 1) != 0;
+    input.right = (bits & 2) != 0;
+    input.fire = (bits & 4) != 0;
+    return input;
+}
+
+void Replay::record(const InputState& input, uint64_t stateHash) {
+    inputs.push_back(pack(input));
+    hashes.push_back(fold(stateHash));
+}
+
+bool Replay::save(const char* path) const {
+    std::vector<InputRun> runs;
+    for (uint8_t bits : inputs) {
+        if (!runs.empty() && runs.back().bits == bits && runs.back().count < 0xFFFF) {
+            runs.back().count++;
+        } else {
+            runs.push_back(InputRun{ bits, 1 });
+        }
+    }
+
+    ReplayFileHeader header;
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.seed = seed;
+    header.tickSeconds = tickSeconds;
+    header.collisionMode = collisionMode;
+    header.tickCount = (uint32_t)inputs.size();
+    header.runCount = (uint32_t)runs.size();
+
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+    for (const InputRun& run : runs) {
+        ok = ok && fwrite(&run.bits, 1, 1, f) == 1 && fwrite(&run.count, 2, 1, f) == 1;
+    }
+    if (ok && !hashes.empty()) {
+        ok = fwrite(hashes.data(), sizeof(uint32_t), hashes.size(), f) == hashes.size();
+    }
+    return fclose(f) == 0 && ok;
+}
+
+bool Replay::load(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+
+    ReplayFileHeader header;
+    bool ok = fread(&header, sizeof(header), 1, f) == 1 &&
+              memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 &&
+              header.version == VERSION;
+
+    inputs.clear();
+    hashes.clear();
+    for (uint32_t r = 0; ok && r < header.runCount; ++r) {
+        InputRun run;
+        ok = fread(&run.bits, 1, 1, f) == 1 && fread(&run.count, 2, 1, f) == 1;
+        // A corrupt file must not grow inputs past the ticks it claims
+        ok = ok && inputs.size() + run.count <= header.tickCount;
+        if (ok) inputs.insert(inputs.end(), run.count, run.bits);
+    }
+    ok = ok && inputs.size() == header.tickCount;
+    if (ok) {
+        // Nor allocate hashes the file does not hold
+        long at = ftell(f);
+        ok = fseek(f, 0, SEEK_END) == 0 && ftell(f) - at >= (long)(header.tickCount * sizeof(uint32_t)) &&
+             fseek(f, at, SEEK_SET) == 0;
+    }
+    if (ok) {
+        hashes.resize(header.tickCount);
+        ok = header.tickCount == 0 ||
+             fread(hashes.data(), sizeof(uint32_t), hashes.size(), f) == hashes.size();
+    }
+    fclose(f);
+
+    if (!ok) {
+        inputs.clear();
+        hashes.clear();
+        return false;
+    }
+    seed = header.seed;
+    tickSeconds = header.tickSeconds;
+    collisionMode = header.collisionMode;
+    return true;
+}
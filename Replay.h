@@ -0,0 +1,48 @@
+// Replay.h
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "InputState.h"
+
+// A recorded run: the seed, the tick length and the input of every tick, plus
+// the state hash after each tick. Playing the inputs back through a fresh
+// GameState must reproduce every hash; the first tick that does not is where
+// the simulation's behaviour changed.
+//
+// File layout (little-endian): header, then input runs (byte + uint16 repeat
+// count; held keys rarely change between ticks), then one uint32 hash per tick.
+class Replay {
+public:
+    uint32_t seed;
+    float tickSeconds;
+    int collisionMode; // GameState::CollisionMode the run used
+
+    Replay() : seed(0), tickSeconds(0.0f), collisionMode(0) {}
+    Replay(uint32_t pseed, float ptickSeconds, int pcollisionMode)
+        : seed(pseed), tickSeconds(ptickSeconds), collisionMode(pcollisionMode) {}
+
+    // Call once per tick, after GameState::update
+    void record(const InputState& input, uint64_t stateHash);
+
+    size_t ticks() const { return inputs.size(); }
+    InputState input(size_t tick) const { return unpack(inputs[tick]); }
+    uint32_t hash(size_t tick) const { return hashes[tick]; }
+
+    bool save(const char* path) const;
+    bool load(const char* path);
+
+    // 64-bit state hash folded to the 32 bits stored per tick
+    static uint32_t fold(uint64_t stateHash) { return (uint32_t)(stateHash ^ (stateHash >> 32)); }
+
+private:
+    std::vector<uint8_t> inputs; // One packed InputState per tick
+    std::vector<uint32_t> hashes;
+
+    static uint8_t pack(const InputState& input);
+    static InputState unpack(uint8_t bits);
+};
+
+#endif
@@ -0,0 +1,325 @@
+// Scenario.cpp
+#include "Scenario.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "Emitter.h"
+
+namespace {
+
+const float BULLET_SPEED = 600.0f;
+const float FAN_STEP = 0.15f; // Radians between bullets of a volley (as the player's spread)
+const int MAX_RETARGETS = 8;  // Gunner resizes per step before timing regardless
+
+struct StepResult {
+    size_t targetBullets, targetEnemies;
+    double bullets, enemies, enemyBullets; // Means over the timed ticks
+    double p50, p90, p99, max; // Tick time, ms
+    double phaseUs[PHASE_COUNT];
+    size_t bulletMisses;
+};
+
+size_t geometric(size_t from, size_t to, int step, int steps) {
+    if (steps <= 1) return to;
+    double t = (double)step / (steps - 1);
+    return (size_t)(from * std::pow((double)to / from, t) + 0.5);
+}
+
+double percentile(std::vector<double>& sorted, double p) {
+    size_t i = (size_t)(p * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(i, sorted.size() - 1)];
+}
+
+class StepDriver {
+public:
+    StepDriver(const ScenarioOptions& popts, GameState& pgs, size_t ptargetBullets, size_t ptargetEnemies)
+        : opts(popts), gs(pgs), targetBullets(ptargetBullets), targetEnemies(ptargetEnemies), rng(popts.seed, 2),
+          enemyBudget(0.0f), bestGunners(0), bestError(0.0) {
+        // First guess: bullets live about one screen height. Fanned-out ones
+        // leave through the sides and enemies stop others, so retarget()
+        // corrects it from the live count
+        float perGunner = std::max(opts.fireRate * opts.spread * lifetime(), 1.0f);
+        setGunners(std::max<size_t>(1, (size_t)std::ceil(targetBullets / perGunner)));
+    }
+
+    // Seconds a bullet takes to cross the screen from the gunners' line
+    float lifetime() const { return opts.worldHeight / BULLET_SPEED; }
+
+    // Rescales the gunners by how far liveBullets (a mean over the last
+    // lifetime) misses the target. True once within 5%, or once a resize
+    // stopped getting closer: a dense enemy field spends bullets faster the
+    // more there are, and a fixed capacity caps them. Then the closest
+    // gunner count so far is kept.
+    bool retarget(double liveBullets) {
+        double error = std::fabs(liveBullets - (double)targetBullets);
+        if (bestGunners && error >= bestError) {
+            setGunners(bestGunners);
+            return true;
+        }
+        bestGunners = gunners;
+        bestError = error;
+        if (error <= targetBullets * 0.05) return true;
+        double scale = liveBullets >= 1.0 ? std::min(targetBullets / liveBullets, 4.0) : 4.0;
+        setGunners(std::max<size_t>(1, (size_t)std::ceil(gunners * scale)));
+        return false;
+    }
+
+    void tick(float dt) {
+        recycleSunkEnemies();
+        fire(dt);
+        topUpEnemies(dt);
+    }
+
+private:
+    const ScenarioOptions& opts;
+    GameState& gs;
+    size_t targetBullets, targetEnemies;
+    size_t gunners;
+    std::vector<float> cooldown;
+    Random rng;
+    float enemyBudget;
+    size_t bestGunners; // Closest to the target so far, 0 before the first retarget()
+    double bestError;
+
+    void setGunners(size_t count) {
+        gunners = count;
+        cooldown.resize(gunners);
+        for (size_t i = 0; i < gunners; ++i) cooldown[i] = (float)i / gunners / opts.fireRate; // Staggered
+    }
+
+    void fire(float dt) {
+        float spacing = opts.worldWidth / gunners;
+        int center = opts.spread / 2;
+        for (size_t g = 0; g < gunners; ++g) {
+            cooldown[g] -= dt;
+            if (cooldown[g] > 0.0f) continue;
+            cooldown[g] += 1.0f / opts.fireRate;
+
+            float x = (g + 0.5f) * spacing;
+            float y = opts.worldHeight - 10.0f;
+            for (int i = 0; i < opts.spread; ++i) {
+                float angle = -1.5707963f + (i - center) * FAN_STEP;
+                gs.bullets.spawn(x, y, cosf(angle) * BULLET_SPEED, sinf(angle) * BULLET_SPEED,
+                                 10, opts.pierce, BULLET_LASER, true);
+            }
+        }
+    }
+
+    // Enemies drift down; left alone they would pile up on the gunners' line
+    // and swallow each volley as it spawns, so the live bullet count would
+    // sink through the step. Past recycleFloor() they go back above the top
+    // instead, which keeps the field's density steady.
+    float recycleFloor() const { return opts.worldHeight * 0.75f; }
+    void recycleSunkEnemies() {
+        float floor = recycleFloor();
+        for (Enemy* e : gs.enemyPool.activeObjects) {
+            if (e->y <= floor) continue;
+            e->y = -20.0f - rng.nextFloat() * 100.0f;
+            e->prevY = e->y;
+        }
+    }
+
+    void topUpEnemies(float dt) {
+        size_t active = gs.enemyPool.activeObjects.size();
+        if (active >= targetEnemies) return;
+        size_t wanted = targetEnemies - active;
+        if (opts.enemySpawnRate > 0.0f) {
+            enemyBudget = std::min(enemyBudget + opts.enemySpawnRate * dt, (float)wanted);
+            wanted = (size_t)enemyBudget;
+            enemyBudget -= wanted;
+        }
+        for (size_t i = 0; i < wanted; ++i) {
+            // Anywhere in the band the field cycles through, so it starts (and
+            // stays) as dense as it will be
+            float y = -120.0f + rng.nextFloat() * (recycleFloor() + 120.0f);
+            Enemy proto(20.0f + rng.nextFloat() * (opts.worldWidth - 40.0f), y, opts.enemyHp, rng.range(0, 2), 80.0f, rng.range(0, 2));
+            proto.prevX = proto.x;
+            proto.prevY = proto.y;
+            proto.emitter = (uint8_t)opts.emitter;
+            proto.fireTimer = rng.nextFloat() * emitterPattern(opts.emitter).interval; // Unsynchronized volleys
+            proto.serial = gs.nextEnemySerial++;
+            if (!gs.enemyPool.acquireCopy(proto)) break;
+        }
+    }
+};
+
+StepResult runStep(const ScenarioOptions& opts, size_t targetBullets, size_t targetEnemies) {
+    SimConfig config;
+    config.bulletCapacity = opts.bulletCapacity ? opts.bulletCapacity : targetBullets + targetBullets / 4;
+    config.bulletsGrowable = opts.bulletCapacity == 0;
+    config.enemyCapacity = opts.enemyCapacity ? opts.enemyCapacity : targetEnemies;
+    config.enemiesGrowable = opts.enemyCapacity == 0;
+    config.worldWidth = opts.worldWidth;
+    config.worldHeight = opts.worldHeight;
+    config.hitStop = false; // Measure the work, not the freeze frames
+    config.playerTakesDamage = false; // No iframes either: the player test runs every tick
+
+    GameState gs(opts.seed, nullptr, config);
+    gs.collisionMode = opts.collisionMode;
+    gs.setJobSystem(opts.jobs);
+    gs.nextEliteAt = INT_MAX; // Elites would add hit-stop style pauses and one-off spikes
+    StepDriver driver(opts, gs, targetBullets, targetEnemies);
+
+    Profiler profiler((size_t)opts.ticksPerStep);
+    std::vector<double> tickMs;
+    tickMs.reserve(opts.ticksPerStep);
+    double bulletSum = 0.0, enemySum = 0.0, enemyBulletSum = 0.0;
+
+    // Warm up: fill the screen, then resize the gunners once per bullet
+    // lifetime until the live count settles near the target, then give the
+    // last resize a lifetime (at least a third of the timed ticks) to settle
+    int lifetimeTicks = std::max((int)std::ceil(driver.lifetime() / opts.deltaTime), 2);
+    auto untimed = [&](int ticks) { // Mean live bullets over the second half
+        double sum = 0.0;
+        for (int t = 0; t < ticks; ++t) {
+            driver.tick(opts.deltaTime);
+            gs.update(opts.deltaTime);
+            if (t >= ticks / 2) sum += gs.bullets.size();
+        }
+        return sum / (ticks - ticks / 2);
+    };
+    untimed(lifetimeTicks);
+    for (int round = 0; round < MAX_RETARGETS && !driver.retarget(untimed(lifetimeTicks)); ++round) {}
+    untimed(std::max(opts.ticksPerStep / 3, lifetimeTicks));
+
+    gs.setProfiler(&profiler);
+    for (int t = 0; t < opts.ticksPerStep; ++t) {
+        driver.tick(opts.deltaTime);
+        profiler.beginFrame();
+
+        auto start = std::chrono::steady_clock::now();
+        gs.update(opts.deltaTime);
+        auto end = std::chrono::steady_clock::now();
+
+        profiler.setCounts(gs.enemyPool.activeObjects.size(), gs.bullets.size() + gs.enemyBullets.size());
+        profiler.endFrame();
+        tickMs.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        bulletSum += gs.bullets.size();
+        enemySum += gs.enemyPool.activeObjects.size();
+        enemyBulletSum += gs.enemyBullets.size();
+    }
+
+    StepResult r;
+    r.targetBullets = targetBullets;
+    r.targetEnemies = targetEnemies;
+    r.bullets = bulletSum / opts.ticksPerStep;
+    r.enemies = enemySum / opts.ticksPerStep;
+    r.enemyBullets = enemyBulletSum / opts.ticksPerStep;
+    std::sort(tickMs.begin(), tickMs.end());
+    r.p50 = percentile(tickMs, 0.50);
+    r.p90 = percentile(tickMs, 0.90);
+    r.p99 = percentile(tickMs, 0.99);
+    r.max = tickMs.back();
+    Profiler::Frame avg = profiler.average(profiler.size());
+    for (int p = 0; p < PHASE_COUNT; ++p) r.phaseUs[p] = avg.ms[p] * 1000.0;
+    r.bulletMisses = gs.bullets.stats().misses;
+    return r;
+}
+
+// Simulation phases reported per step, and the entity count each scales with
+enum Scaling { PER_BULLET, PER_ENEMY, PER_ENEMY_BULLET };
+struct PhaseColumn {
+    ProfilePhase phase;
+    Scaling scaling;
+};
+const PhaseColumn COLUMNS[] = {
+    { PHASE_SPAWN, PER_ENEMY }, { PHASE_ENEMIES, PER_ENEMY }, { PHASE_BULLETS, PER_BULLET },
+    { PHASE_EMITTERS, PER_ENEMY_BULLET }, { PHASE_BROADPHASE, PER_ENEMY }, { PHASE_COLLISION, PER_BULLET },
+    { PHASE_HIT_RESOLVE, PER_BULLET }, { PHASE_PLAYER_HITS, PER_ENEMY_BULLET }, { PHASE_DAMAGE_NUMBERS, PER_BULLET },
+};
+const char* const SCALING_NAMES[] = { "bullet", "enemy", "shot" };
+
+double entities(const StepResult& r, Scaling scaling) {
+    switch (scaling) {
+        case PER_BULLET: return r.bullets;
+        case PER_ENEMY: return r.enemies;
+        default: return r.enemyBullets;
+    }
+}
+const int COLUMN_COUNT = sizeof(COLUMNS) / sizeof(COLUMNS[0]);
+
+} // namespace
+
+int runScenario(const ScenarioOptions& opts) {
+    if (opts.steps < 1 || opts.ticksPerStep < 1 || opts.bulletsFrom == 0 || opts.enemiesFrom == 0 ||
+        opts.fireRate <= 0.0f || opts.spread < 1) {
+        fprintf(stderr, "scenario: steps, ticks, counts, fire rate and spread must be positive\n");
+        return 1;
+    }
+
+    printf("scenario:      %d steps, bullets %zu->%zu, enemies %zu->%zu, %d ticks/step\n", opts.steps,
+           opts.bulletsFrom, opts.bulletsTo, opts.enemiesFrom, opts.enemiesTo, opts.ticksPerStep);
+    printf("weapons:       %.1f volleys/s, spread %d, pierce %d; world %.0fx%.0f; collision %s\n",
+           opts.fireRate, opts.spread, opts.pierce, opts.worldWidth, opts.worldHeight,
+           opts.collisionMode == GameState::COLLISION_GRID ? "grid" : "sweep");
+    printf("enemy fire:    %s; threads %u\n\n", opts.emitter ? emitterName(opts.emitter) : "none",
+           opts.jobs ? opts.jobs->workerCount() : 1);
+
+    printf("%4s %9s %8s %9s %8s %8s %8s %8s", "step", "bullets", "enemies", "shots", "p50 ms", "p90 ms", "p99 ms",
+           "max ms");
+    for (int c = 0; c < COLUMN_COUNT; ++c) printf(" %10.10s", profilePhaseName(COLUMNS[c].phase));
+    printf("  (phase columns: mean us/tick)\n");
+
+    FILE* out = nullptr;
+    if (opts.outPath) {
+        out = fopen(opts.outPath, "w");
+        if (!out) {
+            fprintf(stderr, "could not write %s\n", opts.outPath);
+            return 1;
+        }
+        fprintf(out, "step\ttarget_bullets\ttarget_enemies\tbullets\tenemies\tenemy_bullets\tp50_ms\tp90_ms\tp99_ms\tmax_ms");
+        for (int p = 0; p < PHASE_COUNT; ++p) fprintf(out, "\t%s_us", profilePhaseName((ProfilePhase)p));
+        fprintf(out, "\tbullet_misses\n");
+    }
+
+    std::vector<StepResult> results;
+    for (int step = 0; step < opts.steps; ++step) {
+        StepResult r = runStep(opts, geometric(opts.bulletsFrom, opts.bulletsTo, step, opts.steps),
+                               geometric(opts.enemiesFrom, opts.enemiesTo, step, opts.steps));
+        results.push_back(r);
+
+        printf("%4d %9.0f %8.0f %9.0f %8.3f %8.3f %8.3f %8.3f", step, r.bullets, r.enemies, r.enemyBullets, r.p50,
+               r.p90, r.p99, r.max);
+        for (int c = 0; c < COLUMN_COUNT; ++c) printf(" %10.1f", r.phaseUs[COLUMNS[c].phase]);
+        printf("\n");
+        fflush(stdout);
+
+        if (out) {
+            fprintf(out, "%d\t%zu\t%zu\t%.0f\t%.0f\t%.0f\t%.4f\t%.4f\t%.4f\t%.4f", step, r.targetBullets,
+                    r.targetEnemies, r.bullets, r.enemies, r.enemyBullets, r.p50, r.p90, r.p99, r.max);
+            for (int p = 0; p < PHASE_COUNT; ++p) fprintf(out, "\t%.2f", r.phaseUs[p]);
+            fprintf(out, "\t%zu\n", r.bulletMisses);
+        }
+    }
+    if (out) fclose(out);
+
+    // Where the curve bends: the first step whose cost per entity is 1.5x the
+    // cheapest seen so far (linear scaling keeps the ratio near 1)
+    printf("\ncost per entity (ns), first step to pass 1.5x its best so far:\n");
+    for (int c = 0; c < COLUMN_COUNT; ++c) {
+        const PhaseColumn& col = COLUMNS[c];
+        double best = 0.0;
+        int bend = -1;
+        for (int s = 0; s < (int)results.size(); ++s) {
+            double n = entities(results[s], col.scaling);
+            if (n < 1.0) continue;
+            double perEntity = results[s].phaseUs[col.phase] * 1000.0 / n;
+            if (best == 0.0 || perEntity < best) best = perEntity;
+            else if (bend < 0 && perEntity > best * 1.5) bend = s;
+        }
+        if (entities(results.back(), col.scaling) < 1.0) continue; // e.g. emitters without --emitter
+        double first = results.front().phaseUs[col.phase] * 1000.0 / std::max(1.0, entities(results.front(), col.scaling));
+        double last = results.back().phaseUs[col.phase] * 1000.0 / std::max(1.0, entities(results.back(), col.scaling));
+        printf("  %-16s per %-6s %8.2f -> %8.2f  ", profilePhaseName(col.phase), SCALING_NAMES[col.scaling],
+               first, last);
+        if (bend >= 0) {
+            printf("bends at step %d (%.0f bullets, %.0f enemies)\n", bend, results[bend].bullets, results[bend].enemies);
+        } else {
+            printf("scales linearly\n");
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,39 @@
+// Scenario.h
+#ifndef SCENARIO_H
+#define SCENARIO_H
+
+#include <cstddef>
+#include "GameState.h"
+
+// Stress ramp for shooter_sim --scenario: each step builds a GameState sized
+// for its targets and holds the entity counts there while timing update().
+// Bullets come from a row of gunners along the bottom (fireRate volleys per
+// second, spread bullets per volley, enough gunners to sustain the target);
+// enemies are topped up at the top and may all fire one emitter pattern. Targets grow geometrically from the
+// "from" to the "to" counts over the steps.
+struct ScenarioOptions {
+    int steps = 8;
+    size_t bulletsFrom = 1000, bulletsTo = 200000;
+    size_t enemiesFrom = 100, enemiesTo = 20000;
+    size_t bulletCapacity = 0; // 0 = sized to each step's target
+    size_t enemyCapacity = 0;
+    int ticksPerStep = 300;    // Timed ticks (plus a third more untimed to fill up)
+    float deltaTime = 1.0f / 60.0f;
+    float fireRate = 10.0f;    // Volleys per second per gunner
+    int spread = 5;            // Bullets per volley
+    int pierce = 0;
+    float enemySpawnRate = 0.0f; // Max enemies added per second (0 = top up at once)
+    int enemyHp = 50;
+    int emitter = 0;           // EmitterId every enemy fires (0 = none)
+    float worldWidth = 800.0f, worldHeight = 600.0f;
+    unsigned int seed = 1;
+    GameState::CollisionMode collisionMode = GameState::COLLISION_GRID;
+    const char* outPath = nullptr; // TSV, one row per step
+    JobSystem* jobs = nullptr;     // Parallel update phases (not owned)
+};
+
+// Prints per-step tick-time percentiles and per-phase costs, then where each
+// subsystem's cost per entity starts to climb. Returns a process exit code.
+int runScenario(const ScenarioOptions& opts);
+
+#endif
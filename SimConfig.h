@@ -0,0 +1,24 @@
+// SimConfig.h
+#ifndef SIMCONFIG_H
+#define SIMCONFIG_H
+
+#include <cstddef>
+
+// Runtime sizing of a GameState, fixed at construction. The defaults are the
+// game's own (800x600 world, 100 bullets, enemy pool growing by 50); stress
+// runs raise them from the command line.
+struct SimConfig {
+    size_t bulletCapacity = 100;
+    bool bulletsGrowable = false; // Fixed cap: misses show up in bullets.stats()
+    size_t enemyBulletCapacity = 1024; // Enemy bullets have their own store
+    bool enemyBulletsGrowable = true;
+    size_t enemyCapacity = 50;    // Also the growth chunk
+    bool enemiesGrowable = true;
+    size_t damageNumberCapacity = 256;
+    float worldWidth = 800.0f;    // Simulation area; the window stays SCREEN_WIDTH x SCREEN_HEIGHT
+    float worldHeight = 600.0f;
+    bool hitStop = true;          // Freeze on hits/elites; off when measuring raw cost
+    bool playerTakesDamage = true; // Off: hits on the player are still tested and counted, but cost nothing
+};
+
+#endif
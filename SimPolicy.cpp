@@ -0,0 +1,41 @@
+// SimPolicy.cpp
+#include "SimPolicy.h"
+#include "GameState.h"
+#include <cstring>
+
+bool parseSimPolicy(const char* name, SimPolicy& out) {
+    if (strcmp(name, "idle") == 0) { out = POLICY_IDLE; return true; }
+    if (strcmp(name, "fire") == 0) { out = POLICY_FIRE; return true; }
+    if (strcmp(name, "autopilot") == 0) { out = POLICY_AUTOPILOT; return true; }
+    return false;
+}
+
+const char* simPolicyName(SimPolicy policy) {
+    switch (policy) {
+        case POLICY_IDLE: return "idle";
+        case POLICY_FIRE: return "fire";
+        case POLICY_AUTOPILOT: return "autopilot";
+    }
+    return "?";
+}
+
+InputState simPolicyInput(SimPolicy policy, const GameState& gs) {
+    InputState input;
+    if (policy == POLICY_IDLE) return input;
+
+    input.fire = true;
+    if (policy != POLICY_AUTOPILOT) return input;
+
+    // Chase the enemy closest to the bottom of the screen that is already visible
+    const Enemy* target = nullptr;
+    for (const Enemy* e : gs.enemyPool.activeObjects) {
+        if (e->y < 0) continue;
+        if (!target || e->y > target->y) target = e;
+    }
+    if (target) {
+        const float deadZone = 4.0f;
+        if (target->x < gs.player.x - deadZone) input.left = true;
+        if (target->x > gs.player.x + deadZone) input.right = true;
+    }
+    return input;
+}
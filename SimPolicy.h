@@ -0,0 +1,20 @@
+// SimPolicy.h
+#ifndef SIMPOLICY_H
+#define SIMPOLICY_H
+
+#include "InputState.h"
+
+class GameState;
+
+// Scripted "players" for headless runs (no keyboard available).
+enum SimPolicy {
+    POLICY_IDLE = 0,      // Never moves, never fires
+    POLICY_FIRE = 1,      // Stands still and holds fire
+    POLICY_AUTOPILOT = 2  // Holds fire and tracks the lowest on-screen enemy
+};
+
+bool parseSimPolicy(const char* name, SimPolicy& out);
+const char* simPolicyName(SimPolicy policy);
+InputState simPolicyInput(SimPolicy policy, const GameState& gs);
+
+#endif
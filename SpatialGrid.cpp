@@ -0,0 +1,131 @@
+// SpatialGrid.cpp
+#include "SpatialGrid.h"
+#include <algorithm> // For std::fill, std::sort, std::unique
+#include <cmath>     // For ceilf
+
+SpatialGrid::SpatialGrid(float pcellSize, float minX, float minY, float maxX, float maxY)
+    : cellSize(pcellSize),
+      invCellSize(1.0f / pcellSize),
+      originX(minX),
+      originY(minY),
+      limitX(maxX),
+      limitY(maxY),
+      cols((int)ceilf((maxX - minX) / pcellSize)),
+      rowCount((int)ceilf((maxY - minY) / pcellSize))
+{
+    if (cols < 1) cols = 1;
+    if (rowCount < 1) rowCount = 1;
+    cellStart.assign((size_t)cols * rowCount + 1, 0);
+    cursor.resize((size_t)cols * rowCount);
+}
+
+// floorf is a libm call without SSE4.1; truncate and fix up negatives instead
+static inline int floorToInt(float v) {
+    int i = (int)v;
+    return (v < (float)i) ? i - 1 : i;
+}
+
+// The max bound itself belongs to the last column/row. When the extent is an
+// exact multiple of the cell size it would land one past the grid.
+int SpatialGrid::cellX(float x) const {
+    int cx = floorToInt((x - originX) * invCellSize);
+    return (cx == cols && x <= limitX) ? cols - 1 : cx;
+}
+
+int SpatialGrid::cellY(float y) const {
+    int cy = floorToInt((y - originY) * invCellSize);
+    return (cy == rowCount && y <= limitY) ? rowCount - 1 : cy;
+}
+
+void SpatialGrid::clear() {
+    pending.clear();
+}
+
+void SpatialGrid::insert(uint32_t id, float minX, float minY, float maxX, float maxY) {
+    Entry e;
+    e.id = id;
+    e.cx0 = clampX(cellX(minX));
+    e.cy0 = clampY(cellY(minY));
+    e.cx1 = clampX(cellX(maxX));
+    e.cy1 = clampY(cellY(maxY));
+    pending.push_back(e);
+}
+
+void SpatialGrid::build() {
+    // Pass 1: count entries per cell
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+    for (const Entry& e : pending) {
+        for (int cy = e.cy0; cy <= e.cy1; ++cy)
+            for (int cx = e.cx0; cx <= e.cx1; ++cx)
+                cellStart[(size_t)cy * cols + cx + 1]++;
+    }
+
+    // Prefix sum -> start offsets
+    size_t cellCount = (size_t)cols * rowCount;
+    for (size_t c = 0; c < cellCount; ++c) {
+        cellStart[c + 1] += cellStart[c];
+    }
+
+    // Pass 2: scatter ids (insertion order preserved inside each cell)
+    items.resize(cellStart[cellCount]);
+    for (size_t c = 0; c < cellCount; ++c) cursor[c] = cellStart[c];
+    for (const Entry& e : pending) {
+        for (int cy = e.cy0; cy <= e.cy1; ++cy)
+            for (int cx = e.cx0; cx <= e.cx1; ++cx)
+                items[cursor[(size_t)cy * cols + cx]++] = e.id;
+    }
+}
+
+SpatialGrid::Range SpatialGrid::query(float x, float y) const {
+    return cellRange(cellX(x), cellY(y));
+}
+
+SpatialGrid::Range SpatialGrid::cellRange(int cx, int cy) const {
+    Range r;
+    r.first = r.last = items.data();
+    if (cx < 0 || cy < 0 || cx >= cols || cy >= rowCount) return r;
+
+    size_t c = (size_t)cy * cols + cx;
+    r.first = items.data() + cellStart[c];
+    r.last = items.data() + cellStart[c + 1];
+    return r;
+}
+
+SpatialGrid::Range SpatialGrid::querySegment(float x0, float y0, float x1, float y1,
+                                             std::vector<uint32_t>& scratch) const {
+    int cx0 = clampX(cellX(x0)), cy0 = clampY(cellY(y0));
+    int cx1 = clampX(cellX(x1)), cy1 = clampY(cellY(y1));
+    if (cx0 == cx1 && cy0 == cy1) return cellRange(cx0, cy0); // Common case: no copy
+
+    scratch.clear();
+    gatherCells(std::min(cx0, cx1), std::min(cy0, cy1), std::max(cx0, cx1), std::max(cy0, cy1), scratch);
+    Range r;
+    r.first = scratch.data();
+    r.last = scratch.data() + scratch.size();
+    return r;
+}
+
+void SpatialGrid::queryBox(float minX, float minY, float maxX, float maxY, std::vector<uint32_t>& out) const {
+    gatherCells(cellX(minX), cellY(minY), cellX(maxX), cellY(maxY), out);
+}
+
+void SpatialGrid::gatherCells(int cx0, int cy0, int cx1, int cy1, std::vector<uint32_t>& out) const {
+    cx0 = std::max(cx0, 0);
+    cy0 = std::max(cy0, 0);
+    cx1 = std::min(cx1, cols - 1);
+    cy1 = std::min(cy1, rowCount - 1);
+    if (cx0 > cx1 || cy0 > cy1) return;
+
+    size_t first = out.size();
+    for (int cy = cy0; cy <= cy1; ++cy) {
+        for (int cx = cx0; cx <= cx1; ++cx) {
+            size_t c = (size_t)cy * cols + cx;
+            out.insert(out.end(), items.data() + cellStart[c], items.data() + cellStart[c + 1]);
+        }
+    }
+    // Objects spanning several of the cells were added once per cell
+    if (cx0 != cx1 || cy0 != cy1) {
+        std::sort(out.begin() + first, out.end());
+        out.erase(std::unique(out.begin() + first, out.end()), out.end());
+    }
+}
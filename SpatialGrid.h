@@ -0,0 +1,68 @@
+// SpatialGrid.h
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+#include <cstdint>
+#include <vector>
+
+// Uniform-grid broadphase over a fixed rectangle. Objects are inserted by
+// AABB into every cell they overlap, then build() packs the cells into one
+// contiguous array (counting sort) so a point query is a single slice.
+//
+// Usage per tick: clear(); insert(...) for every object; build(); query(...).
+// Ids within a cell keep insertion order, so results are deterministic.
+class SpatialGrid {
+public:
+    SpatialGrid(float cellSize, float minX, float minY, float maxX, float maxY);
+
+    void clear();
+    // Parts of the AABB outside the grid rectangle go to its edge cells
+    void insert(uint32_t id, float minX, float minY, float maxX, float maxY);
+    void build();
+
+    // Ids whose AABB overlaps the cell containing (x, y). Empty outside the grid.
+    struct Range {
+        const uint32_t* first;
+        const uint32_t* last;
+        const uint32_t* begin() const { return first; }
+        const uint32_t* end() const { return last; }
+        bool empty() const { return first == last; }
+    };
+    Range query(float x, float y) const;
+    // Ids whose AABB overlaps any cell the box touches, each once, sorted by
+    // id, appended to out. For swept queries (a moving point's path).
+    void queryBox(float minX, float minY, float maxX, float maxY, std::vector<uint32_t>& out) const;
+    // Candidates along the segment (x0, y0) -> (x1, y1): the cell's own slice
+    // when both ends share a cell, else queryBox of its bounds into scratch.
+    // Ends outside the grid count as its nearest edge cell, where inserts
+    // beyond the edge went: a segment leaving the grid still finds them.
+    Range querySegment(float x0, float y0, float x1, float y1, std::vector<uint32_t>& scratch) const;
+
+    int columns() const { return cols; }
+    int rows() const { return rowCount; }
+
+private:
+    float cellSize;
+    float invCellSize;
+    float originX, originY;
+    float limitX, limitY; // maxX, maxY: inside the grid (inclusive)
+    int cols, rowCount;
+
+    struct Entry {
+        uint32_t id;
+        int cx0, cy0, cx1, cy1; // Inclusive cell range
+    };
+    std::vector<Entry> pending;
+    std::vector<uint32_t> cellStart; // cols*rows + 1 offsets into items
+    std::vector<uint32_t> items;
+    std::vector<uint32_t> cursor;    // Scratch for build()
+
+    int cellX(float x) const;
+    int cellY(float y) const;
+    int clampX(int cx) const { return cx < 0 ? 0 : (cx >= cols ? cols - 1 : cx); }
+    int clampY(int cy) const { return cy < 0 ? 0 : (cy >= rowCount ? rowCount - 1 : cy); }
+    Range cellRange(int cx, int cy) const;
+    void gatherCells(int cx0, int cy0, int cx1, int cy1, std::vector<uint32_t>& out) const;
+};
+
+#endif
@@ -0,0 +1,37 @@
+// StateHash.h
+#ifndef STATEHASH_H
+#define STATEHASH_H
+
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+// FNV-1a over raw bytes. Floats are hashed by bit pattern, so any change in
+// the simulation's arithmetic shows up, not just visible differences.
+class StateHash {
+public:
+    StateHash() : value(14695981039346656037ULL) {}
+
+    void addBytes(const void* data, size_t size) {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            value ^= p[i];
+            value *= 1099511628211ULL;
+        }
+    }
+    void add(int v) { addBytes(&v, sizeof(v)); }
+    void add(uint32_t v) { addBytes(&v, sizeof(v)); }
+    void add(bool v) { unsigned char b = v ? 1 : 0; addBytes(&b, 1); }
+    void add(float v) {
+        uint32_t bits;
+        memcpy(&bits, &v, sizeof(bits));
+        add(bits);
+    }
+
+    uint64_t get() const { return value; }
+
+private:
+    uint64_t value;
+};
+
+#endif
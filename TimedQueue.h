@@ -0,0 +1,53 @@
+// TimedQueue.h
+#ifndef TIMEDQUEUE_H
+#define TIMEDQUEUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// Items ordered by the time they become due. Stored as a sorted array plus a
+// read index: popping is O(1) (no erase from the front) and pushing in time
+// order, which is how waves are scheduled, is an O(1) append. An out-of-order
+// push is placed by binary search after any entries with the same time.
+// clear() keeps the storage, so steady-state scheduling never allocates.
+template <typename T>
+class TimedQueue {
+public:
+    TimedQueue() : head(0) {}
+
+    void clear() { entries.clear(); head = 0; }
+    void reserve(size_t n) { entries.reserve(n); }
+
+    bool empty() const { return head == entries.size(); }
+    size_t size() const { return entries.size() - head; }
+
+    void push(float time, const T& item) {
+        if (empty() || time >= entries.back().time) {
+            entries.push_back(Entry{ time, item });
+            return;
+        }
+        auto pos = std::upper_bound(entries.begin() + head, entries.end(), time,
+                                    [](float t, const Entry& e) { return t < e.time; });
+        entries.insert(pos, Entry{ time, item });
+    }
+
+    // Earliest item, due at or before now? (false when empty)
+    bool due(float now) const { return !empty() && entries[head].time <= now; }
+    float nextTime() const { return entries[head].time; }
+    const T& front() const { return entries[head].item; }
+
+    void pop() {
+        if (++head == entries.size()) clear(); // Drained: rewind instead of growing
+    }
+
+private:
+    struct Entry {
+        float time;
+        T item;
+    };
+    std::vector<Entry> entries;
+    size_t head;
+};
+
+#endif
@@ -0,0 +1,46 @@
+// TripleBuffer.h
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+#include <atomic>
+
+// Hands the latest value from one producer thread to one consumer thread
+// without locks. The producer fills back() and publish()es it; the consumer
+// calls acquire() and reads front(). Three slots mean neither side ever waits:
+// the producer may publish any number of times between two acquires (the
+// consumer only sees the newest), and a value is never written while read.
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() : middle(1), backIndex(2), frontIndex(0) {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // Producer side. Slots are reused, so back() holds an older value to
+    // overwrite (keeping its allocations).
+    T& back() { return slots[backIndex]; }
+    void publish() {
+        backIndex = middle.exchange(backIndex | FRESH, std::memory_order_acq_rel) & INDEX;
+    }
+
+    // Consumer side. Takes the newest published value into front(); false
+    // (front() unchanged) when nothing was published since the last acquire.
+    bool acquire() {
+        if (!(middle.load(std::memory_order_acquire) & FRESH)) return false;
+        frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+    const T& front() const { return slots[frontIndex]; }
+
+private:
+    static const unsigned INDEX = 3; // Slot index bits of middle
+    static const unsigned FRESH = 4; // middle holds a value not yet acquired
+
+    T slots[3];
+    std::atomic<unsigned> middle; // The slot between the two sides, plus FRESH
+    unsigned backIndex;           // Producer only
+    unsigned frontIndex;          // Consumer only
+};
+
+#endif
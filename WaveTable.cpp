@@ -0,0 +1,119 @@
+// WaveTable.cpp
+#include "WaveTable.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static bool fail(std::string* error, const std::string& message) {
+    if (error) *error = message;
+    return false;
+}
+
+WaveTable::WaveTable()
+    : mapping(nullptr), mappingSize(0), header(nullptr), waves(nullptr), spawns(nullptr) {}
+
+WaveTable::~WaveTable() {
+    close();
+}
+
+void WaveTable::close() {
+#ifndef _WIN32
+    if (mapping) munmap(mapping, mappingSize);
+#endif
+    mapping = nullptr;
+    mappingSize = 0;
+    fallback.clear();
+    header = nullptr;
+    waves = nullptr;
+    spawns = nullptr;
+}
+
+bool WaveTable::open(const char* path, std::string* error) {
+    close();
+
+    const void* data = nullptr;
+    size_t size = 0;
+#ifndef _WIN32
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) return fail(error, std::string("cannot open ") + path);
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        ::close(fd);
+        return fail(error, std::string("cannot stat ") + path);
+    }
+    size = (size_t)st.st_size;
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping stays valid
+    if (mapped == MAP_FAILED) return fail(error, std::string("cannot map ") + path);
+    mapping = mapped;
+    mappingSize = size;
+    data = mapped;
+#else
+    FILE* f = fopen(path, "rb");
+    if (!f) return fail(error, std::string("cannot open ") + path);
+    unsigned char buffer[4096];
+    size_t got;
+    while ((got = fread(buffer, 1, sizeof(buffer), f)) > 0) fallback.insert(fallback.end(), buffer, buffer + got);
+    fclose(f);
+    data = fallback.data();
+    size = fallback.size();
+#endif
+
+    if (!validate(data, size, error)) {
+        close();
+        return false;
+    }
+    header = static_cast<const WaveTableHeader*>(data);
+    waves = reinterpret_cast<const WaveRecord*>(header + 1);
+    spawns = reinterpret_cast<const SpawnRecord*>(waves + header->waveCount);
+    return true;
+}
+
+bool WaveTable::validate(const void* data, size_t size, std::string* error) {
+    if (size < sizeof(WaveTableHeader)) return fail(error, "file too small for a header");
+
+    const WaveTableHeader* h = static_cast<const WaveTableHeader*>(data);
+    if (memcmp(h->magic, "WSWT", 4) != 0) return fail(error, "bad magic (not a wave table)");
+    if (h->version != VERSION) return fail(error, "unsupported version " + std::to_string(h->version));
+    if (h->firstWave < 1) return fail(error, "firstWave must be at least 1");
+
+    // 64-bit arithmetic: counts come from the file and must not overflow
+    uint64_t expected = sizeof(WaveTableHeader)
+                      + (uint64_t)h->waveCount * sizeof(WaveRecord)
+                      + (uint64_t)h->spawnCount * sizeof(SpawnRecord);
+    if (expected != size) {
+        return fail(error, "size " + std::to_string(size) + " does not match header (expected " +
+                           std::to_string(expected) + ")");
+    }
+
+    const WaveRecord* w = reinterpret_cast<const WaveRecord*>(h + 1);
+    const SpawnRecord* s = reinterpret_cast<const SpawnRecord*>(w + h->waveCount);
+    for (uint32_t i = 0; i < h->waveCount; ++i) {
+        std::string where = "wave " + std::to_string(h->firstWave + i) + ": ";
+        if ((uint64_t)w[i].firstSpawn + w[i].spawnCount > h->spawnCount) return fail(error, where + "spawn range out of bounds");
+        if (w[i].hp <= 0) return fail(error, where + "hp must be positive");
+        if (!std::isfinite(w[i].speed) || w[i].speed < 0.0f) return fail(error, where + "bad speed");
+
+        float lastTime = 0.0f;
+        for (uint32_t j = 0; j < w[i].spawnCount; ++j) {
+            const SpawnRecord& sp = s[w[i].firstSpawn + j];
+            std::string at = where + "spawn " + std::to_string(j) + ": ";
+            if (!std::isfinite(sp.time) || sp.time < lastTime) return fail(error, at + "times must be finite and sorted");
+            if (!std::isfinite(sp.xOffset)) return fail(error, at + "bad xOffset");
+            if (!(sp.hpScale > 0.0f) || !std::isfinite(sp.hpScale)) return fail(error, at + "hpScale must be positive");
+            if (!(sp.speedScale >= 0.0f) || !std::isfinite(sp.speedScale)) return fail(error, at + "bad speedScale");
+            if (sp.type > MAX_TYPE) return fail(error, at + "type out of range");
+            if (sp.pattern > MAX_PATTERN) return fail(error, at + "pattern out of range");
+            if (sp.flags & ~(SpawnRecord::RANDOM_TYPE | SpawnRecord::RANDOM_X)) return fail(error, at + "unknown flags");
+            lastTime = sp.time;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,93 @@
+// WaveTable.h
+#ifndef WAVETABLE_H
+#define WAVETABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Binary wave definitions, mapped straight from disk and read in place: the
+// file is a header followed by fixed-size little-endian records, so loading
+// is one mmap plus a bounds check and starting a wave is an array lookup.
+// Build files from text with `wavetool compile` (see wavetool.cpp).
+//
+// Layout: WaveTableHeader, waveCount WaveRecords, spawnCount SpawnRecords.
+// Wave record i describes wave firstWave + i; its spawns are the
+// contiguous run [firstSpawn, firstSpawn + spawnCount), sorted by time.
+
+struct WaveTableHeader {
+    char magic[4];      // "WSWT"
+    uint32_t version;
+    uint32_t firstWave; // Wave number of the first record
+    uint32_t waveCount;
+    uint32_t spawnCount;
+    uint32_t reserved;
+};
+
+struct WaveRecord {
+    uint32_t firstSpawn;
+    uint32_t spawnCount;
+    int32_t hp;  // Base HP for this wave (stat curve evaluated at compile time)
+    float speed; // Base speed for this wave
+};
+
+struct SpawnRecord {
+    enum Flags : uint8_t {
+        RANDOM_TYPE = 1 << 0, // Type drawn from the game's rng (0-2)
+        RANDOM_X = 1 << 1     // xOffset drawn from the game's rng (-30..29)
+    };
+
+    float time;       // Seconds after the wave starts
+    float xOffset;    // From the screen centre
+    float hpScale;    // Multiplies the wave's base HP
+    float speedScale; // Multiplies the wave's base speed
+    uint8_t type;
+    uint8_t pattern;  // Enemy movement pattern (0-2)
+    uint8_t flags;    // Flags
+    uint8_t padding;
+};
+
+class WaveTable {
+public:
+    static const uint32_t VERSION = 1;
+    static const int MAX_TYPE = 2;
+    static const int MAX_PATTERN = 2;
+
+    WaveTable();
+    ~WaveTable();
+    WaveTable(const WaveTable&) = delete;
+    WaveTable& operator=(const WaveTable&) = delete;
+
+    // Maps path read-only and validates it. On failure returns false, leaves
+    // the table empty and, if error is given, says why.
+    bool open(const char* path, std::string* error = nullptr);
+    void close();
+    bool isOpen() const { return header != nullptr; }
+
+    // Checks a whole file image: sizes, record bounds, sorted spawn times
+    // and value ranges. Used by open() and by `wavetool validate`.
+    static bool validate(const void* data, size_t size, std::string* error);
+
+    // nullptr when wave is not in the table (the game falls back to its formula)
+    const WaveRecord* wave(int number) const {
+        if (!header || number < (int)header->firstWave) return nullptr;
+        uint32_t index = (uint32_t)(number - (int)header->firstWave);
+        return index < header->waveCount ? &waves[index] : nullptr;
+    }
+    const SpawnRecord* spawnsOf(const WaveRecord& w) const { return spawns + w.firstSpawn; }
+
+    uint32_t firstWave() const { return header ? header->firstWave : 0; }
+    uint32_t waveCount() const { return header ? header->waveCount : 0; }
+    uint32_t spawnCount() const { return header ? header->spawnCount : 0; }
+
+private:
+    void* mapping;     // mmap'd file, or nullptr
+    size_t mappingSize;
+    std::vector<unsigned char> fallback; // File contents where mmap is unavailable
+    const WaveTableHeader* header;
+    const WaveRecord* waves;
+    const SpawnRecord* spawns;
+};
+
+#endif
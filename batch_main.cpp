@@ -0,0 +1,163 @@
+// batch_main.cpp
+// Batch runner: plays a range of seeds headless on every core and writes one
+// row per game. Build with `make shooter_batch` (no SDL needed).
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "GameState.h"
+#include "SimPolicy.h"
+#include "JobSystem.h"
+
+struct BatchOptions {
+    unsigned int firstSeed = 1;
+    unsigned int runs = 1000;
+    long ticks = 36000; // 10 minutes at 60 Hz
+    float deltaTime = 1.0f / 60.0f;
+    SimPolicy policy = POLICY_AUTOPILOT;
+    unsigned threads = 0; // 0 = one per hardware thread
+    const char* outPath = "batch_results.tsv";
+    const char* wavesPath = nullptr;
+};
+
+// One column per metric, one row per run (index = seed - firstSeed). Each job
+// writes only its own rows, so no locking is needed.
+struct BatchResults {
+    std::vector<unsigned int> seed;
+    std::vector<long> ticks;
+    std::vector<int> wave;
+    std::vector<int> score;
+    std::vector<int> kills;
+    std::vector<int> eliteKills;
+    std::vector<int> upgrades;
+    std::vector<unsigned char> gameOver;
+
+    explicit BatchResults(size_t n)
+        : seed(n), ticks(n), wave(n), score(n), kills(n), eliteKills(n), upgrades(n), gameOver(n) {}
+};
+
+static void printUsage(const char* prog) {
+    printf("Usage: %s [--seeds FIRST-LAST] [--ticks N] [--hz RATE]\n"
+           "       [--policy idle|fire|autopilot] [--threads N] [--out FILE] [--waves FILE.wst]\n", prog);
+}
+
+static bool parseArgs(int argc, char* argv[], BatchOptions& opts) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--seeds") == 0 && hasValue) {
+            unsigned int first = 0, last = 0;
+            if (sscanf(argv[++i], "%u-%u", &first, &last) != 2 || last < first) return false;
+            opts.firstSeed = first;
+            opts.runs = last - first + 1;
+        } else if (strcmp(arg, "--ticks") == 0 && hasValue) {
+            opts.ticks = atol(argv[++i]);
+        } else if (strcmp(arg, "--hz") == 0 && hasValue) {
+            float hz = (float)atof(argv[++i]);
+            if (hz <= 0.0f) return false;
+            opts.deltaTime = 1.0f / hz;
+        } else if (strcmp(arg, "--policy") == 0 && hasValue) {
+            if (!parseSimPolicy(argv[++i], opts.policy)) return false;
+        } else if (strcmp(arg, "--threads") == 0 && hasValue) {
+            opts.threads = (unsigned)atoi(argv[++i]);
+        } else if (strcmp(arg, "--out") == 0 && hasValue) {
+            opts.outPath = argv[++i];
+        } else if (strcmp(arg, "--waves") == 0 && hasValue) {
+            opts.wavesPath = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return opts.ticks > 0 && opts.runs > 0;
+}
+
+static bool writeResults(const char* path, const BatchResults& r) {
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "seed\tticks\twave\tscore\tkills\telite_kills\tupgrades\tgame_over\n");
+    for (size_t i = 0; i < r.seed.size(); ++i) {
+        fprintf(f, "%u\t%ld\t%d\t%d\t%d\t%d\t%d\t%d\n", r.seed[i], r.ticks[i], r.wave[i],
+                r.score[i], r.kills[i], r.eliteKills[i], r.upgrades[i], (int)r.gameOver[i]);
+    }
+    return fclose(f) == 0;
+}
+
+int main(int argc, char* argv[]) {
+    BatchOptions opts;
+    if (!parseArgs(argc, argv, opts)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // One read-only mapping shared by all workers
+    WaveTable waveTable;
+    if (opts.wavesPath) {
+        std::string error;
+        if (!waveTable.open(opts.wavesPath, &error)) {
+            fprintf(stderr, "%s: %s\n", opts.wavesPath, error.c_str());
+            return 1;
+        }
+    }
+
+    JobSystem jobs(opts.threads);
+    BatchResults results(opts.runs);
+
+    // One game per worker, reset() between runs so its allocations are reused
+    std::vector<std::unique_ptr<GameState>> games(jobs.workerCount());
+
+    auto start = std::chrono::steady_clock::now();
+    jobs.parallelFor(opts.runs, 1, [&](size_t begin, size_t end, unsigned worker) {
+        for (size_t run = begin; run < end; ++run) {
+            unsigned int seed = opts.firstSeed + (unsigned int)run;
+            if (!games[worker]) games[worker].reset(new GameState(seed, opts.wavesPath ? &waveTable : nullptr));
+            GameState& gs = *games[worker];
+            gs.reset(seed);
+
+            long t = 0;
+            for (; t < opts.ticks && !gs.isGameOver; ++t) {
+                gs.handleInput(simPolicyInput(opts.policy, gs));
+                gs.update(opts.deltaTime);
+            }
+
+            results.seed[run] = seed;
+            results.ticks[run] = t;
+            results.wave[run] = gs.currentWave;
+            results.score[run] = gs.score;
+            results.kills[run] = gs.enemiesKilled;
+            results.eliteKills[run] = gs.elitesKilled;
+            results.upgrades[run] = gs.player.totalUpgrades();
+            results.gameOver[run] = gs.isGameOver ? 1 : 0;
+        }
+    });
+    auto end = std::chrono::steady_clock::now();
+
+    if (!writeResults(opts.outPath, results)) {
+        fprintf(stderr, "could not write %s\n", opts.outPath);
+        return 1;
+    }
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double gamesPerSec = seconds > 0.0 ? opts.runs / seconds : 0.0;
+    long totalTicks = 0;
+    int minWave = results.wave[0], maxWave = results.wave[0];
+    double waveSum = 0.0;
+    for (size_t i = 0; i < opts.runs; ++i) {
+        totalTicks += results.ticks[i];
+        minWave = std::min(minWave, results.wave[i]);
+        maxWave = std::max(maxWave, results.wave[i]);
+        waveSum += results.wave[i];
+    }
+
+    printf("policy:        %s\n", simPolicyName(opts.policy));
+    printf("seeds:         %u-%u (%u games)\n", opts.firstSeed, opts.firstSeed + opts.runs - 1, opts.runs);
+    printf("threads:       %u (%zu steals)\n", jobs.workerCount(), jobs.steals());
+    printf("wall time:     %.3f s\n", seconds);
+    printf("games/sec:     %.2f (%.2f per thread)\n", gamesPerSec, gamesPerSec / jobs.workerCount());
+    printf("ticks/sec:     %.0f\n", seconds > 0.0 ? totalTicks / seconds : 0.0);
+    printf("wave:          min %d, mean %.2f, max %d\n", minWave, waveSum / opts.runs, maxWave);
+    printf("results:       %s\n", opts.outPath);
+    return 0;
+}
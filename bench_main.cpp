@@ -0,0 +1,467 @@
+// bench_main.cpp
+// Microbenchmarks for the simulation's hot paths, each run in isolation at a
+// range of entity counts. Build with `make bench` (no SDL needed).
+//
+//   ./shooter_bench --sizes 100,10000,1000000 --out now.csv
+//   ./shooter_bench --baseline before.csv --threshold 10
+//
+// Results are CSV (benchmark,size,ns_per_item,mitems_per_sec,samples). With
+// --baseline every result is compared against the matching row of an earlier
+// CSV; anything slower by more than --threshold percent is reported as a
+// regression and the exit code is 3.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Bullet.h"
+#include "BulletStore.h"
+#include "DamageNumbers.h"
+#include "Enemy.h"
+#include "FixedPool.h"
+#include "GameState.h"
+#include "Narrowphase.h"
+#include "ObjectPool.h"
+#include "Random.h"
+#include "RenderSnapshot.h"
+
+struct BenchOptions {
+    std::vector<size_t> sizes = { 100, 1000, 10000, 100000, 1000000 };
+    double minSeconds = 0.2; // Timed time per benchmark and size
+    const char* filter = nullptr;
+    const char* outPath = nullptr;
+    const char* baselinePath = nullptr;
+    double threshold = 10.0; // Percent
+};
+
+struct BenchResult {
+    std::string name;
+    size_t size;
+    double nsPerItem;
+    size_t samples;
+};
+
+typedef std::function<void()> Step;
+
+// Times body (which processes items items) until minSeconds of samples are
+// collected; setup runs untimed before each sample. Without a setup the body
+// is repeated inside a sample so tiny sizes are not dominated by the clock.
+// Returns the median ns per item.
+static double measure(size_t items, const Step& setup, const Step& body, double minSeconds, size_t& samplesOut) {
+    typedef std::chrono::steady_clock Clock;
+    size_t reps = setup ? 1 : std::max<size_t>(1, 100000 / items);
+
+    if (setup) setup();
+    body(); // Warm-up
+
+    std::vector<double> samples;
+    double timed = 0.0;
+    while ((timed < minSeconds || samples.size() < 5) && samples.size() < 10000) {
+        if (setup) setup();
+        Clock::time_point start = Clock::now();
+        for (size_t r = 0; r < reps; ++r) body();
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        timed += seconds;
+        samples.push_back(seconds * 1e9 / (double)(items * reps));
+    }
+    std::sort(samples.begin(), samples.end());
+    samplesOut = samples.size();
+    return samples[samples.size() / 2];
+}
+
+class BenchRunner {
+public:
+    explicit BenchRunner(const BenchOptions& popts) : opts(popts) {}
+
+    bool wants(const std::string& name) const {
+        return !opts.filter || name.find(opts.filter) != std::string::npos;
+    }
+
+    void run(const std::string& name, size_t size, const Step& setup, const Step& body) {
+        if (!wants(name)) return;
+        BenchResult r;
+        r.name = name;
+        r.size = size;
+        r.nsPerItem = measure(size, setup, body, opts.minSeconds, r.samples);
+        results.push_back(r);
+        printf("%-32s %9zu %10.3f ns/item %10.2f Mitems/s\n", name.c_str(), size, r.nsPerItem, 1e3 / r.nsPerItem);
+        fflush(stdout);
+    }
+
+    const std::vector<BenchResult>& all() const { return results; }
+
+private:
+    const BenchOptions& opts;
+    std::vector<BenchResult> results;
+};
+
+static volatile float sink; // Keeps results observable so loops are not optimized away
+
+// --- ObjectPool / FixedPool ---
+
+static void benchPools(BenchRunner& bench, size_t n) {
+    ObjectPool<Enemy> pool(n);
+    std::vector<PoolHandle> handles(n);
+    std::vector<Enemy*> objects(n);
+    Random rng(1);
+
+    auto fill = [&] {
+        pool.releaseAll();
+        for (size_t i = 0; i < n; ++i) objects[i] = pool.acquire(&handles[i]);
+    };
+    // Release order shuffled: real games free enemies in arbitrary order
+    auto fillShuffled = [&] {
+        fill();
+        for (size_t i = n - 1; i > 0; --i) {
+            size_t j = rng.nextInt((uint32_t)(i + 1));
+            std::swap(handles[i], handles[j]);
+            std::swap(objects[i], objects[j]);
+        }
+    };
+
+    bench.run("pool.acquire", n, [&] { pool.releaseAll(); },
+              [&] { for (size_t i = 0; i < n; ++i) pool.acquire(); });
+    bench.run("pool.releaseAt", n, fill,
+              [&] { while (!pool.activeObjects.empty()) pool.releaseAt(0); });
+    bench.run("pool.release_handle", n, fillShuffled,
+              [&] { for (size_t i = 0; i < n; ++i) pool.release(handles[i]); });
+    bench.run("pool.release_ptr", n, fillShuffled,
+              [&] { for (size_t i = 0; i < n; ++i) pool.release(objects[i]); });
+
+    if (bench.wants("fixedpool.acquire_release") && n <= (1u << 20)) {
+        typedef FixedPool<Enemy, (1u << 20)> BigPool;
+        std::unique_ptr<BigPool> fixed(new BigPool());
+        bench.run("fixedpool.acquire_release", n, Step(), [&] {
+            for (size_t i = 0; i < n; ++i) fixed->acquire();
+            while (fixed->size() > 0) fixed->releaseAt(0);
+        });
+    }
+}
+
+// --- Bullets ---
+
+static const char* const BULLET_NAMES[3] = { "laser", "spread", "plasma" };
+
+static void benchBullets(BenchRunner& bench, size_t n) {
+    const float dt = 1.0f / 60.0f;
+    for (int type = BULLET_LASER; type <= BULLET_PLASMA; ++type) {
+        std::string suffix = BULLET_NAMES[type];
+
+        // Legacy array-of-structs Bullet::update
+        if (bench.wants("bullet.update." + suffix)) {
+            std::vector<Bullet> aos(n);
+            for (size_t i = 0; i < n; ++i) {
+                Bullet& b = aos[i];
+                b.x = (float)(i % 800);
+                b.y = (float)(i % 600);
+                b.vx = 0.0f;
+                b.vy = -500.0f;
+                b.speed = 500.0f;
+                b.baseAngle = -1.5707963f;
+                b.wavePhase = (float)i;
+                b.type = type;
+            }
+            bench.run("bullet.update." + suffix, n, Step(), [&] {
+                for (Bullet& b : aos) b.update(dt);
+                sink = aos[n / 2].y;
+            });
+        }
+
+        // Structure-of-arrays BulletStore kernel the game runs (bounds wide enough that nothing culls)
+        if (bench.wants("bulletstore.integrate." + suffix)) {
+            BulletStore store(n);
+            for (size_t i = 0; i < n; ++i) {
+                store.spawn((float)(i % 800), (float)(i % 600), 0.0f, -500.0f, 10, 0, type, true);
+            }
+            bench.run("bulletstore.integrate." + suffix, n, Step(), [&] {
+                store.integrateAndCull(dt, -1e30f, -1e30f, 1e30f, 1e30f);
+            });
+        }
+    }
+}
+
+// --- Enemies ---
+
+static void benchEnemies(BenchRunner& bench, size_t n) {
+    const float dt = 1.0f / 60.0f;
+    for (int pattern = 0; pattern <= 2; ++pattern) {
+        std::string name = "enemy.update.pattern" + std::to_string(pattern);
+        if (!bench.wants(name)) continue;
+
+        std::vector<Enemy> enemies(n);
+        for (size_t i = 0; i < n; ++i) {
+            enemies[i].x = (float)(i % 800);
+            enemies[i].y = (float)(i % 600);
+            enemies[i].speed = 100.0f;
+            enemies[i].pattern = pattern;
+        }
+        bench.run(name, n, Step(), [&] {
+            for (Enemy& e : enemies) e.update(dt);
+            sink = enemies[n / 2].y;
+        });
+    }
+}
+
+// --- Bullet -> enemy collision ---
+
+// n bullets against min(n, 500) enemies spread over the world (a very dense
+// late wave); enemies never die so every sample sees the same scene. Items
+// are bullets. Bullets are respawned untimed before each sample.
+// collision.detect.* time detection alone (broad phase and queries, emitting
+// damage events): it changes nothing, so one scene serves every sample.
+static void benchCollision(BenchRunner& bench, size_t n) {
+    const size_t enemyCount = std::min<size_t>(n, 500);
+    const GameState::CollisionMode modes[2] = { GameState::COLLISION_SWEEP, GameState::COLLISION_GRID };
+    const char* const names[2] = { "collision.sweep", "collision.grid" };
+    const char* const detectNames[2] = { "collision.detect.sweep", "collision.detect.grid" };
+
+    for (int m = 0; m < 2; ++m) {
+        bool full = bench.wants(names[m]);
+        bool detect = bench.wants(detectNames[m]);
+        if (!full && !detect) continue;
+
+        GameState gs(1);
+        gs.collisionMode = modes[m];
+        gs.enemyPool.releaseAll();
+        gs.enemyPool.setGrowable(true);
+        gs.bullets.setGrowable(true);
+
+        Random rng(7);
+        for (size_t i = 0; i < enemyCount; ++i) {
+            Enemy* e = gs.enemyPool.acquire();
+            e->x = rng.nextFloat() * gs.config.worldWidth;
+            e->y = rng.nextFloat() * gs.config.worldHeight;
+            e->prevX = e->x; // Standing still: the swept test sees no enemy motion
+            e->prevY = e->y;
+            e->hp = e->maxHp = 1000000000;
+        }
+        std::vector<float> bx(n), by(n);
+        for (size_t i = 0; i < n; ++i) {
+            bx[i] = rng.nextFloat() * gs.config.worldWidth;
+            by[i] = rng.nextFloat() * gs.config.worldHeight;
+        }
+
+        auto respawn = [&] {
+            gs.bullets.clear();
+            for (size_t i = 0; i < n; ++i) gs.bullets.spawn(bx[i], by[i], 0.0f, -500.0f, 1, 0, BULLET_LASER, true);
+        };
+        if (full) bench.run(names[m], n, respawn, [&] { gs.collideBullets(); });
+        if (detect) {
+            respawn();
+            bench.run(detectNames[m], n, Step(), [&] {
+                gs.detectBulletHits();
+                sink = (float)gs.damageEvents().size();
+            });
+        }
+    }
+}
+
+// --- Player narrowphase ---
+
+// n candidates against the player's hitbox, none overlapping, so every scan
+// runs to the end (the worst case: a tick in which nothing hits). Items are
+// candidates.
+static void benchPlayerHits(BenchRunner& bench, size_t n) {
+    BulletStore shots(n);
+    Random rng(11);
+    for (size_t i = 0; i < n; ++i) {
+        shots.spawn(rng.nextFloat() * 800.0f, rng.nextFloat() * 500.0f, 0.0f, 150.0f, 5, 0, BULLET_SPREAD, false);
+    }
+    bench.run("player_hits.bullets", n, Step(), [&] {
+        sink = (float)firstPointInCircle(shots.x.get(), shots.y.get(), shots.size(), 400.0f, 580.0f, 11.0f);
+    });
+
+    size_t padded = (n + 7) & ~(size_t)7;
+    std::vector<float> ex(padded), ey(padded), er(padded, 20.0f);
+    for (size_t i = 0; i < n; ++i) {
+        ex[i] = rng.nextFloat() * 800.0f;
+        ey[i] = rng.nextFloat() * 500.0f;
+    }
+    bench.run("player_hits.enemies", n, Step(), [&] {
+        sink = (float)firstCircleOverlap(ex.data(), ey.data(), er.data(), n, 400.0f, 580.0f, 8.0f);
+    });
+}
+
+// --- Damage numbers ---
+
+static void benchDamageNumbers(BenchRunner& bench, size_t n) {
+    DamageNumberBuffer numbers(n);
+    for (size_t i = 0; i < n; ++i) numbers.add((float)(i % 800), 300.0f, 10, false, PoolHandle::invalid());
+    // Tiny steps: nothing expires however many samples run
+    bench.run("damage_numbers.update", n, Step(), [&] { numbers.update(1e-9f); });
+
+    DamageNumberBuffer coalescing(n);
+    coalescing.setCoalesceWindow(0.1f);
+    bench.run("damage_numbers.add_coalesce", n, [&] { coalescing.clear(); }, [&] {
+        for (size_t i = 0; i < n; ++i) {
+            PoolHandle owner{ (uint32_t)(i % 200), 0 }; // 200 enemies taking hits
+            coalescing.add(400.0f, 300.0f, 10, false, owner);
+        }
+    });
+}
+
+// --- Render snapshot ---
+
+// Copying what the renderer draws out of a game: n player bullets, n / 4
+// enemy bullets and min(n, 500) enemies. Items are player bullets.
+static void benchSnapshot(BenchRunner& bench, size_t n) {
+    if (!bench.wants("render_snapshot.capture")) return;
+
+    GameState gs(1);
+    gs.enemyPool.releaseAll();
+    gs.enemyPool.setGrowable(true);
+    gs.bullets.setGrowable(true);
+    gs.enemyBullets.setGrowable(true);
+
+    Random rng(13);
+    for (size_t i = 0; i < std::min<size_t>(n, 500); ++i) {
+        Enemy* e = gs.enemyPool.acquire();
+        e->x = e->prevX = rng.nextFloat() * gs.config.worldWidth;
+        e->y = e->prevY = rng.nextFloat() * gs.config.worldHeight;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        gs.bullets.spawn(rng.nextFloat() * gs.config.worldWidth, rng.nextFloat() * gs.config.worldHeight, 0.0f, -500.0f,
+                         1, 0, BULLET_LASER, true);
+    }
+    for (size_t i = 0; i < n / 4; ++i) {
+        gs.enemyBullets.spawn(rng.nextFloat() * gs.config.worldWidth, rng.nextFloat() * gs.config.worldHeight, 0.0f,
+                              150.0f, 5, 0, BULLET_SPREAD, false);
+    }
+
+    RenderSnapshot snapshot;
+    bench.run("render_snapshot.capture", n, Step(), [&] {
+        snapshot.capture(gs);
+        sink = (float)snapshot.bullets.size();
+    });
+}
+
+// --- Output and baseline comparison ---
+
+static bool writeCsv(const char* path, const std::vector<BenchResult>& results) {
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "benchmark,size,ns_per_item,mitems_per_sec,samples\n");
+    for (const BenchResult& r : results) {
+        fprintf(f, "%s,%zu,%.4f,%.4f,%zu\n", r.name.c_str(), r.size, r.nsPerItem, 1e3 / r.nsPerItem, r.samples);
+    }
+    return fclose(f) == 0;
+}
+
+static bool readBaseline(const char* path, std::map<std::string, double>& out) {
+    FILE* f = fopen(path, "r");
+    if (!f) return false;
+    char line[512];
+    while (fgets(line, sizeof(line), f)) {
+        char name[256];
+        size_t size;
+        double ns;
+        if (sscanf(line, "%255[^,],%zu,%lf", name, &size, &ns) == 3) {
+            out[std::string(name) + "@" + std::to_string(size)] = ns;
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+// Returns the number of regressions
+static int compareBaseline(const BenchOptions& opts, const std::vector<BenchResult>& results) {
+    std::map<std::string, double> baseline;
+    if (!readBaseline(opts.baselinePath, baseline)) {
+        fprintf(stderr, "could not read baseline %s\n", opts.baselinePath);
+        return -1;
+    }
+
+    int regressions = 0;
+    printf("\nagainst %s (threshold %.1f%%):\n", opts.baselinePath, opts.threshold);
+    for (const BenchResult& r : results) {
+        auto it = baseline.find(r.name + "@" + std::to_string(r.size));
+        if (it == baseline.end()) {
+            printf("%-32s %9zu %10.3f ns/item  (not in baseline)\n", r.name.c_str(), r.size, r.nsPerItem);
+            continue;
+        }
+        double delta = (r.nsPerItem - it->second) / it->second * 100.0;
+        const char* verdict = "";
+        if (delta > opts.threshold) {
+            verdict = "  REGRESSION";
+            regressions++;
+        } else if (delta < -opts.threshold) {
+            verdict = "  faster";
+        }
+        printf("%-32s %9zu %10.3f -> %10.3f ns/item %+7.1f%%%s\n", r.name.c_str(), r.size,
+               it->second, r.nsPerItem, delta, verdict);
+    }
+    return regressions;
+}
+
+static void printUsage(const char* prog) {
+    printf("Usage: %s [--sizes N,N,...] [--min-time SECONDS] [--filter SUBSTRING]\n"
+           "       [--out FILE.csv] [--baseline FILE.csv] [--threshold PERCENT]\n", prog);
+}
+
+static bool parseArgs(int argc, char* argv[], BenchOptions& opts) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--sizes") == 0 && hasValue) {
+            opts.sizes.clear();
+            for (char* p = argv[++i]; *p;) {
+                char* end;
+                unsigned long v = strtoul(p, &end, 10);
+                if (end == p || v == 0) return false;
+                opts.sizes.push_back(v);
+                p = *end == ',' ? end + 1 : end;
+            }
+        } else if (strcmp(arg, "--min-time") == 0 && hasValue) {
+            opts.minSeconds = atof(argv[++i]);
+        } else if (strcmp(arg, "--filter") == 0 && hasValue) {
+            opts.filter = argv[++i];
+        } else if (strcmp(arg, "--out") == 0 && hasValue) {
+            opts.outPath = argv[++i];
+        } else if (strcmp(arg, "--baseline") == 0 && hasValue) {
+            opts.baselinePath = argv[++i];
+        } else if (strcmp(arg, "--threshold") == 0 && hasValue) {
+            opts.threshold = atof(argv[++i]);
+        } else {
+            return false;
+        }
+    }
+    return !opts.sizes.empty();
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions opts;
+    if (!parseArgs(argc, argv, opts)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    BenchRunner bench(opts);
+    for (size_t n : opts.sizes) {
+        benchPools(bench, n);
+        benchBullets(bench, n);
+        benchEnemies(bench, n);
+        benchCollision(bench, n);
+        benchPlayerHits(bench, n);
+        benchDamageNumbers(bench, n);
+        benchSnapshot(bench, n);
+    }
+
+    if (opts.outPath && !writeCsv(opts.outPath, bench.all())) {
+        fprintf(stderr, "could not write %s\n", opts.outPath);
+        return 1;
+    }
+    if (opts.baselinePath) {
+        int regressions = compareBaseline(opts, bench.all());
+        if (regressions < 0) return 1;
+        if (regressions > 0) {
+            printf("%d regression(s)\n", regressions);
+            return 3;
+        }
+    }
+    return 0;
+}
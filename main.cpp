@@ -1,14 +1,184 @@
 #include <SDL2/SDL.h>
+#include <time.h>    // For time()
+#include <cstdlib>   // For atof, atoi
+#include <cstring>   // For strcmp
+#include <cstdio>    // For fprintf
+#include <algorithm> // For std::min, std::max
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <thread>
 #include "GameState.h"
+#include "GameRenderer.h"
+#include "FixedTimestep.h"
+#include "Replay.h"
+#include "RenderSnapshot.h"
+#include "TripleBuffer.h"
+
+// Reads the held keys the simulation cares about.
+static InputState readKeyboard() {
+    const Uint8* keystates = SDL_GetKeyboardState(nullptr);
+    InputState input;
+    input.left = keystates[SDL_SCANCODE_LEFT] != 0;
+    input.right = keystates[SDL_SCANCODE_RIGHT] != 0;
+    input.fire = keystates[SDL_SCANCODE_SPACE] != 0;
+    return input;
+}
+
+// --sim-thread: what the simulation thread and the main thread share. Input
+// goes one way as packed bits, snapshots come back through the triple buffer.
+struct SimThreadLink {
+    std::atomic<bool> running{true};
+    std::atomic<unsigned> input{0}; // packInput() of the held keys
+    TripleBuffer<RenderSnapshot> snapshots;
+};
+
+static unsigned packInput(const InputState& input) {
+    return (input.left ? 1u : 0u) | (input.right ? 2u : 0u) | (input.fire ? 4u : 0u);
+}
+
+static InputState unpackInput(unsigned bits) {
+    InputState input;
+    input.left = (bits & 1u) != 0;
+    input.right = (bits & 2u) != 0;
+    input.fire = (bits & 4u) != 0;
+    return input;
+}
+
+static double steadySeconds() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Runs the game at the fixed tick rate until link.running is cleared and
+// publishes a snapshot after every batch of ticks, then sleeps until the next
+// tick is due. Only this thread touches gameState, recording and profiler
+// while it runs.
+static void runSimulation(SimThreadLink& link, GameState& gameState, FixedTimestep& timestep, Replay* recording,
+                          Profiler& profiler) {
+    double last = steadySeconds();
+    while (link.running.load(std::memory_order_relaxed)) {
+        double now = steadySeconds();
+        int steps = timestep.advance(now - last);
+        last = now;
+
+        InputState input = unpackInput(link.input.load(std::memory_order_relaxed));
+        for (int i = 0; i < steps; ++i) {
+            profiler.beginFrame();
+            gameState.handleInput(input);
+            gameState.update(timestep.tickSeconds());
+            profiler.setCounts(gameState.enemyPool.activeObjects.size(),
+                               gameState.bullets.size() + gameState.enemyBullets.size());
+            profiler.endFrame(); // One frame per tick
+            if (recording) recording->record(input, gameState.stateHash());
+        }
+
+        if (steps > 0) {
+            RenderSnapshot& snapshot = link.snapshots.back();
+            snapshot.capture(gameState);
+            snapshot.tickTime = now - timestep.alpha() * timestep.tickSeconds();
+            snapshot.simTiming = profiler.frame(0);
+            link.snapshots.publish();
+        }
+
+        double wait = (1.0 - timestep.alpha()) * timestep.tickSeconds();
+        std::this_thread::sleep_for(std::chrono::duration<double>(wait));
+    }
+}
 
 int main(int argc, char* argv[]) {
+    // --tick-rate HZ: fixed simulation rate (default 120); --max-steps N: cap on
+    // catch-up ticks per frame; --variable-step: old behaviour (one update per frame);
+    // --immediate-background: redraw every background primitive each frame;
+    // --seed S: fixed seed instead of the clock; --record FILE: save the run's
+    // input and per-tick state hashes for `shooter_sim --replay FILE`;
+    // --waves FILE.wst: wave table built by wavetool; --profile-csv FILE: write
+    // the profiler's recent frames on exit; --threads N: workers for the update
+    // (0 = all cores, default 1); --sim-thread: simulate on a thread of its own
+    // while this one renders the latest snapshot. F3 toggles the profiler overlay.
+    float tickRate = 120.0f;
+    int maxStepsPerFrame = 5;
+    bool fixedStep = true;
+    bool cachedBackground = true;
+    unsigned int seed = (unsigned int)time(NULL);
+    const char* recordPath = nullptr;
+    const char* wavesPath = nullptr;
+    const char* profilePath = nullptr;
+    int threads = 1;
+    bool simThread = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc) {
+            tickRate = (float)atof(argv[++i]);
+            if (tickRate <= 0.0f) tickRate = 120.0f;
+        } else if (strcmp(argv[i], "--max-steps") == 0 && i + 1 < argc) {
+            maxStepsPerFrame = atoi(argv[++i]);
+            if (maxStepsPerFrame < 1) maxStepsPerFrame = 1;
+        } else if (strcmp(argv[i], "--variable-step") == 0) {
+            fixedStep = false;
+        } else if (strcmp(argv[i], "--immediate-background") == 0) {
+            cachedBackground = false;
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (unsigned int)strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (strcmp(argv[i], "--waves") == 0 && i + 1 < argc) {
+            wavesPath = argv[++i];
+        } else if (strcmp(argv[i], "--profile-csv") == 0 && i + 1 < argc) {
+            profilePath = argv[++i];
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+            if (threads < 0) threads = 1;
+        } else if (strcmp(argv[i], "--sim-thread") == 0) {
+            simThread = true;
+        }
+    }
+    if (recordPath && !fixedStep) {
+        fprintf(stderr, "--record needs the fixed timestep; ignoring it with --variable-step\n");
+        recordPath = nullptr;
+    }
+    if (simThread && !fixedStep) {
+        fprintf(stderr, "--sim-thread needs the fixed timestep; ignoring it with --variable-step\n");
+        simThread = false;
+    }
+
     SDL_Init(SDL_INIT_VIDEO);
 
     SDL_Window* window = SDL_CreateWindow("Shooter Game", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 800, 600, 0);
     SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
     // std::cout << "main: SDL_CreateRenderer finished." << std::endl;
 
-    GameState gameState(renderer);
+    WaveTable waveTable;
+    if (wavesPath) {
+        std::string error;
+        if (!waveTable.open(wavesPath, &error)) {
+            fprintf(stderr, "%s: %s (using the built-in waves)\n", wavesPath, error.c_str());
+        }
+    }
+
+    GameState gameState(seed, waveTable.isOpen() ? &waveTable : nullptr);
+    std::unique_ptr<JobSystem> jobs;
+    if (threads != 1) {
+        jobs.reset(new JobSystem((unsigned)threads));
+        gameState.setJobSystem(jobs.get());
+    }
+    GameRenderer gameRenderer(renderer);
+    gameRenderer.setBackgroundCached(cachedBackground);
+    Profiler profiler(600); // Last 10 s at 60 fps
+    gameRenderer.setProfiler(&profiler);
+    FixedTimestep timestep(tickRate, maxStepsPerFrame);
+    Replay recording(seed, timestep.tickSeconds(), gameState.collisionMode);
+
+    // --sim-thread: frames show the latest tick's update timings from here
+    Profiler simProfiler(600);
+    gameState.setProfiler(simThread ? &simProfiler : &profiler);
+    std::unique_ptr<SimThreadLink> link;
+    std::thread simulation;
+    if (simThread) {
+        link.reset(new SimThreadLink());
+        simulation = std::thread(runSimulation, std::ref(*link), std::ref(gameState), std::ref(timestep),
+                                 recordPath ? &recording : nullptr, std::ref(simProfiler));
+    }
+    const float tickSeconds = timestep.tickSeconds();
+    RenderSnapshot frameSnapshot; // Single-threaded: captured each frame
 
     bool running = true;
     Uint64 freq = SDL_GetPerformanceFrequency();
@@ -19,29 +189,72 @@ int main(int argc, char* argv[]) {
         Uint64 now = SDL_GetPerformanceCounter();
         float deltaTime = (float)(now - last) / freq;
         last = now;
+        profiler.beginFrame();
 
         SDL_Event event;
         while (SDL_PollEvent(&event)) {
             if (event.type == SDL_QUIT) {
                 running = false;
+            } else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F3 && !event.key.repeat) {
+                gameRenderer.toggleProfilerOverlay();
             }
-            gameState.handleInput(event);
         }
 
-        gameState.update(deltaTime);
+        InputState input = readKeyboard();
+        const RenderSnapshot* snapshot = &frameSnapshot;
+        float alpha = 1.0f;
+        if (simThread) {
+            link->input.store(packInput(input), std::memory_order_relaxed);
+            link->snapshots.acquire(); // Keeps the previous one when no tick finished
+            snapshot = &link->snapshots.front();
+            for (int p = 0; p < PHASE_RENDER_BACKGROUND; ++p) {
+                profiler.add((ProfilePhase)p, snapshot->simTiming.ms[p] / 1000.0);
+            }
+            alpha = (float)((steadySeconds() - snapshot->tickTime) / tickSeconds);
+            alpha = std::min(std::max(alpha, 0.0f), 1.0f);
+        } else if (fixedStep) {
+            int steps = timestep.advance(deltaTime);
+            for (int i = 0; i < steps; ++i) {
+                gameState.handleInput(input);
+                gameState.update(timestep.tickSeconds());
+                if (recordPath) recording.record(input, gameState.stateHash());
+            }
+            alpha = timestep.alpha();
+        } else {
+            gameState.handleInput(input);
+            gameState.update(deltaTime);
+        }
+        if (!simThread) frameSnapshot.capture(gameState);
+        gameRenderer.update(deltaTime, *snapshot);
 
         SDL_SetRenderDrawColor(renderer, 5, 5, 8, 255);
         SDL_RenderClear(renderer);
 
-        gameState.render();
-        
+        gameRenderer.render(*snapshot, alpha);
+
+        profiler.setCounts(snapshot->enemies.size(), snapshot->bullets.size() + snapshot->enemyBullets.size());
+        profiler.endFrame(); // Before present: vsync waits are not frame work
+
         SDL_RenderPresent(renderer);
         // std::cout << "main: End of game loop, after render." << std::endl;
     }
 
+    if (simThread) {
+        link->running.store(false);
+        simulation.join();
+    }
+
+    if (recordPath && !recording.save(recordPath)) {
+        fprintf(stderr, "could not write replay %s\n", recordPath);
+    }
+
+    if (profilePath && !profiler.writeCsv(profilePath)) {
+        fprintf(stderr, "could not write %s\n", profilePath);
+    }
+
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,347 @@
+// sim_main.cpp
+// Headless driver: runs the simulation without a window as fast as the CPU
+// allows and reports throughput. Build with `make shooter_sim` (no SDL needed).
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "GameState.h"
+#include "SimPolicy.h"
+#include "Replay.h"
+#include "Scenario.h"
+#include "Emitter.h"
+
+struct SimOptions {
+    long ticks = 100000;
+    float deltaTime = 1.0f / 60.0f;
+    unsigned int seed = 1;
+    SimPolicy policy = POLICY_AUTOPILOT;
+    GameState::CollisionMode collisionMode = GameState::COLLISION_GRID;
+    float coalesceWindow = 0.0f;
+    bool collisionSet = false;     // --collision given (overrides a replay's mode)
+    const char* recordPath = nullptr;
+    const char* replayPath = nullptr;
+    bool checkIsolation = false;
+    const char* wavesPath = nullptr;
+    const char* profilePath = nullptr;
+    unsigned threads = 1;          // Workers for GameState::update (0 = one per hardware thread)
+    bool scenario = false;
+    ScenarioOptions scenarioOpts; // --seed, --hz and --collision are copied in
+};
+
+static WaveTable waveTable; // Loaded once by --waves, shared by every game
+static std::unique_ptr<JobSystem> jobs; // --threads other than 1
+
+static void printUsage(const char* prog) {
+    printf("Usage: %s [--ticks N] [--hz RATE] [--seed S] [--policy idle|fire|autopilot]\n"
+           "       [--collision sweep|grid] [--coalesce SECONDS]\n"
+           "       [--waves FILE.wst] [--profile FILE.csv] [--threads N]\n"
+           "       [--record FILE] | [--replay FILE] | [--check-isolation]\n"
+           "   or: %s --scenario [--steps N] [--bullets A-B] [--enemies A-B] [--ticks-per-step N]\n"
+           "       [--fire-rate VOLLEYS] [--spread N] [--pierce N] [--spawn-rate PER_SEC]\n"
+           "       [--enemy-hp HP] [--emitter none|fan|radial|spiral|plasma] [--world WxH]\n"
+           "       [--bullet-capacity N] [--enemy-capacity N] [--out FILE.tsv] [--seed S] [--hz RATE] [--collision sweep|grid]\n", prog, prog);
+}
+
+// "A-B" (or a single count for both ends)
+static bool parseRange(const char* text, size_t& from, size_t& to) {
+    char* end = nullptr;
+    from = strtoul(text, &end, 10);
+    to = *end == '-' ? strtoul(end + 1, &end, 10) : from;
+    return *end == '\0' && from > 0 && to > 0;
+}
+
+static bool parseArgs(int argc, char* argv[], SimOptions& opts) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--ticks") == 0 && hasValue) {
+            opts.ticks = atol(argv[++i]);
+        } else if (strcmp(arg, "--hz") == 0 && hasValue) {
+            float hz = (float)atof(argv[++i]);
+            if (hz <= 0.0f) return false;
+            opts.deltaTime = 1.0f / hz;
+        } else if (strcmp(arg, "--seed") == 0 && hasValue) {
+            opts.seed = (unsigned int)strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(arg, "--policy") == 0 && hasValue) {
+            if (!parseSimPolicy(argv[++i], opts.policy)) return false;
+        } else if (strcmp(arg, "--collision") == 0 && hasValue) {
+            const char* mode = argv[++i];
+            if (strcmp(mode, "sweep") == 0) opts.collisionMode = GameState::COLLISION_SWEEP;
+            else if (strcmp(mode, "grid") == 0) opts.collisionMode = GameState::COLLISION_GRID;
+            else return false;
+            opts.collisionSet = true;
+        } else if (strcmp(arg, "--coalesce") == 0 && hasValue) {
+            opts.coalesceWindow = (float)atof(argv[++i]);
+        } else if (strcmp(arg, "--record") == 0 && hasValue) {
+            opts.recordPath = argv[++i];
+        } else if (strcmp(arg, "--replay") == 0 && hasValue) {
+            opts.replayPath = argv[++i];
+        } else if (strcmp(arg, "--waves") == 0 && hasValue) {
+            opts.wavesPath = argv[++i];
+        } else if (strcmp(arg, "--profile") == 0 && hasValue) {
+            opts.profilePath = argv[++i];
+        } else if (strcmp(arg, "--check-isolation") == 0) {
+            opts.checkIsolation = true;
+        } else if (strcmp(arg, "--threads") == 0 && hasValue) {
+            opts.threads = (unsigned)atoi(argv[++i]);
+        } else if (strcmp(arg, "--scenario") == 0) {
+            opts.scenario = true;
+        } else if (strcmp(arg, "--steps") == 0 && hasValue) {
+            opts.scenarioOpts.steps = atoi(argv[++i]);
+        } else if (strcmp(arg, "--bullets") == 0 && hasValue) {
+            if (!parseRange(argv[++i], opts.scenarioOpts.bulletsFrom, opts.scenarioOpts.bulletsTo)) return false;
+        } else if (strcmp(arg, "--enemies") == 0 && hasValue) {
+            if (!parseRange(argv[++i], opts.scenarioOpts.enemiesFrom, opts.scenarioOpts.enemiesTo)) return false;
+        } else if (strcmp(arg, "--ticks-per-step") == 0 && hasValue) {
+            opts.scenarioOpts.ticksPerStep = atoi(argv[++i]);
+        } else if (strcmp(arg, "--fire-rate") == 0 && hasValue) {
+            opts.scenarioOpts.fireRate = (float)atof(argv[++i]);
+        } else if (strcmp(arg, "--spread") == 0 && hasValue) {
+            opts.scenarioOpts.spread = atoi(argv[++i]);
+        } else if (strcmp(arg, "--pierce") == 0 && hasValue) {
+            opts.scenarioOpts.pierce = atoi(argv[++i]);
+        } else if (strcmp(arg, "--spawn-rate") == 0 && hasValue) {
+            opts.scenarioOpts.enemySpawnRate = (float)atof(argv[++i]);
+        } else if (strcmp(arg, "--enemy-hp") == 0 && hasValue) {
+            opts.scenarioOpts.enemyHp = atoi(argv[++i]);
+        } else if (strcmp(arg, "--emitter") == 0 && hasValue) {
+            opts.scenarioOpts.emitter = emitterByName(argv[++i]);
+            if (opts.scenarioOpts.emitter < 0) return false;
+        } else if (strcmp(arg, "--world") == 0 && hasValue) {
+            if (sscanf(argv[++i], "%fx%f", &opts.scenarioOpts.worldWidth, &opts.scenarioOpts.worldHeight) != 2) return false;
+        } else if (strcmp(arg, "--bullet-capacity") == 0 && hasValue) {
+            opts.scenarioOpts.bulletCapacity = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(arg, "--enemy-capacity") == 0 && hasValue) {
+            opts.scenarioOpts.enemyCapacity = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(arg, "--out") == 0 && hasValue) {
+            opts.scenarioOpts.outPath = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return opts.ticks > 0 && !(opts.recordPath && opts.replayPath);
+}
+
+// Feeds a recording back through a fresh GameState and checks the state hash
+// after every tick. Returns 0 when the whole run matches, 2 on divergence.
+static int runReplay(const SimOptions& opts) {
+    Replay replay;
+    if (!replay.load(opts.replayPath)) {
+        fprintf(stderr, "could not read replay %s\n", opts.replayPath);
+        return 1;
+    }
+
+    GameState gs(replay.seed, opts.wavesPath ? &waveTable : nullptr);
+    gs.collisionMode = opts.collisionSet ? opts.collisionMode : (GameState::CollisionMode)replay.collisionMode;
+    gs.setJobSystem(jobs.get());
+
+    long divergedAt = -1;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t tick = 0; tick < replay.ticks(); ++tick) {
+        gs.handleInput(replay.input(tick));
+        gs.update(replay.tickSeconds);
+        if (Replay::fold(gs.stateHash()) != replay.hash(tick)) {
+            divergedAt = (long)tick;
+            break;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    printf("replay:        %s\n", opts.replayPath);
+    printf("seed:          %u\n", replay.seed);
+    printf("collision:     %s\n", gs.collisionMode == GameState::COLLISION_GRID ? "grid" : "sweep");
+    printf("ticks:         %zu at %.1f Hz\n", replay.ticks(), 1.0f / replay.tickSeconds);
+    printf("wall time:     %.3f s\n", std::chrono::duration<double>(end - start).count());
+    if (divergedAt >= 0) {
+        printf("result:        DIVERGED at tick %ld (%.3f s into the run)\n",
+               divergedAt, divergedAt * replay.tickSeconds);
+        printf("               wave %d, score %d, %zu enemies, %zu bullets\n",
+               gs.currentWave, gs.score, gs.enemyPool.activeObjects.size(), gs.bullets.size());
+        return 2;
+    }
+    printf("result:        match (wave %d, score %d)\n", gs.currentWave, gs.score);
+    return 0;
+}
+
+// Gameplay and cosmetic state after one tick: shake and damage numbers must
+// not leak between games either, though replays ignore them.
+struct TickHashes {
+    uint64_t state;
+    uint64_t cosmetic;
+
+    static TickHashes of(const GameState& gs) { return TickHashes{ gs.stateHash(), gs.cosmeticHash() }; }
+    bool operator!=(const TickHashes& o) const { return state != o.state || cosmetic != o.cosmetic; }
+};
+
+// Runs one game for opts.ticks and returns its hashes after every tick.
+static std::vector<TickHashes> runAlone(const SimOptions& opts, unsigned int seed) {
+    GameState gs(seed, opts.wavesPath ? &waveTable : nullptr);
+    gs.collisionMode = opts.collisionMode;
+    std::vector<TickHashes> hashes;
+    hashes.reserve(opts.ticks);
+    for (long t = 0; t < opts.ticks; ++t) {
+        gs.handleInput(simPolicyInput(opts.policy, gs));
+        gs.update(opts.deltaTime);
+        hashes.push_back(TickHashes::of(gs));
+    }
+    return hashes;
+}
+
+// Steps a and b alternately; returns the first tick where either differs from
+// its solo run, or -1.
+static long runInterleaved(const SimOptions& opts, GameState& a, GameState& b,
+                           const std::vector<TickHashes>& soloA, const std::vector<TickHashes>& soloB) {
+    for (long t = 0; t < opts.ticks; ++t) {
+        a.handleInput(simPolicyInput(opts.policy, a));
+        a.update(opts.deltaTime);
+        b.handleInput(simPolicyInput(opts.policy, b));
+        b.update(opts.deltaTime);
+        if (TickHashes::of(a) != soloA[t] || TickHashes::of(b) != soloB[t]) return t;
+    }
+    return -1;
+}
+
+// Two games with different seeds must not affect each other: interleaving
+// them tick by tick, and reusing them via reset(), has to reproduce each
+// game's solo run exactly, cosmetic state included. Exits non-zero on the first mismatch.
+static int runIsolationCheck(const SimOptions& opts) {
+    unsigned int seedA = opts.seed;
+    unsigned int seedB = opts.seed + 1;
+    std::vector<TickHashes> soloA = runAlone(opts, seedA);
+    std::vector<TickHashes> soloB = runAlone(opts, seedB);
+
+    const WaveTable* table = opts.wavesPath ? &waveTable : nullptr;
+    GameState a(seedA, table);
+    GameState b(seedB, table);
+    a.collisionMode = b.collisionMode = opts.collisionMode;
+    long interleaved = runInterleaved(opts, a, b, soloA, soloB);
+
+    // Swap seeds so each instance resets into the other's game
+    a.reset(seedB);
+    b.reset(seedA);
+    long afterReset = runInterleaved(opts, b, a, soloA, soloB);
+
+    printf("seeds:         %u, %u\n", seedA, seedB);
+    printf("ticks:         %ld per game\n", opts.ticks);
+    printf("interleaved:   %s", interleaved < 0 ? "match\n" : "MISMATCH");
+    if (interleaved >= 0) printf(" at tick %ld\n", interleaved);
+    printf("after reset:   %s", afterReset < 0 ? "match\n" : "MISMATCH");
+    if (afterReset >= 0) printf(" at tick %ld\n", afterReset);
+    return (interleaved < 0 && afterReset < 0) ? 0 : 2;
+}
+
+int main(int argc, char* argv[]) {
+    SimOptions opts;
+    if (!parseArgs(argc, argv, opts)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    if (opts.wavesPath) {
+        std::string error;
+        if (!waveTable.open(opts.wavesPath, &error)) {
+            fprintf(stderr, "%s: %s\n", opts.wavesPath, error.c_str());
+            return 1;
+        }
+    }
+
+    if (opts.threads != 1) jobs.reset(new JobSystem(opts.threads));
+
+    if (opts.replayPath) return runReplay(opts);
+    if (opts.checkIsolation) return runIsolationCheck(opts);
+    if (opts.scenario) {
+        opts.scenarioOpts.seed = opts.seed;
+        opts.scenarioOpts.deltaTime = opts.deltaTime;
+        opts.scenarioOpts.collisionMode = opts.collisionMode;
+        opts.scenarioOpts.jobs = jobs.get();
+        return runScenario(opts.scenarioOpts);
+    }
+
+    GameState gs(opts.seed, opts.wavesPath ? &waveTable : nullptr);
+    Replay recording(opts.seed, opts.deltaTime, opts.collisionMode);
+    gs.collisionMode = opts.collisionMode;
+    gs.setDamageNumberCoalescing(opts.coalesceWindow);
+    gs.setJobSystem(jobs.get());
+
+    // --profile: every tick is a frame; the ring keeps up to a million of them
+    std::unique_ptr<Profiler> profiler;
+    if (opts.profilePath) {
+        profiler.reset(new Profiler((size_t)std::min(opts.ticks, 1000000L)));
+        gs.setProfiler(profiler.get());
+    }
+
+    size_t peakEnemies = 0;
+    size_t peakBullets = 0;
+    size_t peakEnemyBullets = 0;
+    long ticksRun = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (; ticksRun < opts.ticks && !gs.isGameOver; ++ticksRun) {
+        if (profiler) profiler->beginFrame();
+        InputState input = simPolicyInput(opts.policy, gs);
+        gs.handleInput(input);
+        gs.update(opts.deltaTime);
+        if (opts.recordPath) recording.record(input, gs.stateHash());
+        if (profiler) {
+            profiler->setCounts(gs.enemyPool.activeObjects.size(), gs.bullets.size() + gs.enemyBullets.size());
+            profiler->endFrame();
+        }
+
+        peakEnemies = std::max(peakEnemies, gs.enemyPool.activeObjects.size());
+        peakBullets = std::max(peakBullets, gs.bullets.size());
+        peakEnemyBullets = std::max(peakEnemyBullets, gs.enemyBullets.size());
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double ticksPerSec = seconds > 0.0 ? ticksRun / seconds : 0.0;
+
+    printf("policy:        %s\n", simPolicyName(opts.policy));
+    printf("seed:          %u\n", opts.seed);
+    printf("collision:     %s\n", opts.collisionMode == GameState::COLLISION_GRID ? "grid" : "sweep");
+    printf("threads:       %u\n", jobs ? jobs->workerCount() : 1);
+    printf("ticks:         %ld (%.1f s simulated)\n", ticksRun, ticksRun * opts.deltaTime);
+    printf("wall time:     %.3f s\n", seconds);
+    printf("ticks/sec:     %.0f\n", ticksPerSec);
+    printf("wave reached:  %d\n", gs.currentWave);
+    printf("score:         %d\n", gs.score);
+    printf("kills:         %d\n", gs.enemiesKilled);
+    printf("enemies:       %zu active, %zu peak\n", gs.enemyPool.activeObjects.size(), peakEnemies);
+    printf("bullets:       %zu active, %zu peak\n", gs.bullets.size(), peakBullets);
+    printf("enemy bullets: %zu active, %zu peak\n", gs.enemyBullets.size(), peakEnemyBullets);
+    printf("player:        %d hp, %d hits taken\n", gs.player.hp, gs.playerHitsTaken);
+    printf("game over:     %s\n", gs.isGameOver ? "yes" : "no");
+
+    const PoolStats& es = gs.enemyPool.stats();
+    const PoolStats& bs = gs.bullets.stats();
+    printf("enemy pool:    capacity %zu, high water %zu, misses %zu, growths %zu\n",
+           es.capacity, es.highWater, es.misses, es.growths);
+    printf("bullet store:  capacity %zu, high water %zu, misses %zu, growths %zu\n",
+           bs.capacity, bs.highWater, bs.misses, bs.growths);
+
+    if (profiler) {
+        Profiler::Frame avg = profiler->average(profiler->size());
+        printf("profile:       mean per tick over the last %zu ticks\n", profiler->size());
+        for (int p = 0; p < PHASE_COUNT; ++p) {
+            if (avg.ms[p] > 0.0f) printf("  %-16s %8.2f us\n", profilePhaseName((ProfilePhase)p), avg.ms[p] * 1000.0f);
+        }
+        if (!profiler->writeCsv(opts.profilePath)) {
+            fprintf(stderr, "could not write %s\n", opts.profilePath);
+            return 1;
+        }
+        printf("profile csv:   %s\n", opts.profilePath);
+    }
+
+    if (opts.recordPath) {
+        if (!recording.save(opts.recordPath)) {
+            fprintf(stderr, "could not write replay %s\n", opts.recordPath);
+            return 1;
+        }
+        printf("recorded:      %s (%zu ticks)\n", opts.recordPath, recording.ticks());
+    }
+    return 0;
+}
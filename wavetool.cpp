@@ -0,0 +1,298 @@
+// wavetool.cpp
+// Wave table compiler and checker. Build with `make wavetool` (no SDL needed).
+//
+//   wavetool compile waves.txt waves.wst   text -> binary (validated before writing)
+//   wavetool validate waves.wst            checks a binary table
+//   wavetool dump waves.wst                prints a binary table
+//
+// Text format, one statement per line, '#' starts a comment:
+//   curve hp BASE PER_WAVE       base HP = BASE + PER_WAVE * wave (for the blocks below)
+//   curve speed BASE PER_WAVE    base speed, same form
+//   wave N | waves FIRST LAST    starts a block; the spawn lines below apply to each wave in it
+//   spawn TIME TYPE X PATTERN [hp=SCALE] [speed=SCALE]
+//   stream START INTERVAL COUNT PER_WAVE TYPE X PATTERN [hp=SCALE] [speed=SCALE]
+//                                COUNT + PER_WAVE * wave spawns, INTERVAL seconds apart
+// TYPE is 0-2 or "random", X an offset from the screen centre or "random",
+// PATTERN 0-2. A stream's count must not go negative in any wave of its block.
+// Blocks must cover consecutive waves in ascending order.
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "WaveTable.h"
+
+struct SpawnLine {
+    bool stream;
+    float start, interval;
+    int countBase, countPerWave;
+    SpawnRecord record; // time/type/x/pattern/scales/flags for one spawn
+};
+
+struct Block {
+    int firstWave, lastWave;
+    double hpBase, hpPerWave, speedBase, speedPerWave;
+    std::vector<SpawnLine> lines;
+};
+
+// Whole word as an integer in [lo, hi]
+static bool parseIntIn(const std::string& word, int lo, int hi, int& out) {
+    char* end;
+    long v = strtol(word.c_str(), &end, 10);
+    if (word.empty() || *end != '\0' || v < lo || v > hi) return false;
+    out = (int)v;
+    return true;
+}
+
+static bool parseSpawnArgs(std::istringstream& in, SpawnRecord& r, std::string& error) {
+    std::string type, x, patternWord;
+    if (!(in >> type >> x >> patternWord)) {
+        error = "expected TYPE X PATTERN";
+        return false;
+    }
+    int typeValue = 0, pattern;
+    if (type != "random" && !parseIntIn(type, 0, WaveTable::MAX_TYPE, typeValue)) {
+        error = "TYPE must be 0-" + std::to_string(WaveTable::MAX_TYPE) + " or 'random', got '" + type + "'";
+        return false;
+    }
+    if (!parseIntIn(patternWord, 0, WaveTable::MAX_PATTERN, pattern)) {
+        error = "PATTERN must be 0-" + std::to_string(WaveTable::MAX_PATTERN) + ", got '" + patternWord + "'";
+        return false;
+    }
+    r.flags = 0;
+    r.padding = 0;
+    if (type == "random") {
+        r.flags |= SpawnRecord::RANDOM_TYPE;
+        r.type = 0;
+    } else {
+        r.type = (uint8_t)typeValue;
+    }
+    if (x == "random") {
+        r.flags |= SpawnRecord::RANDOM_X;
+        r.xOffset = 0.0f;
+    } else {
+        r.xOffset = (float)atof(x.c_str());
+    }
+    r.pattern = (uint8_t)pattern;
+    r.hpScale = 1.0f;
+    r.speedScale = 1.0f;
+
+    std::string opt;
+    while (in >> opt) {
+        if (opt.compare(0, 3, "hp=") == 0) r.hpScale = (float)atof(opt.c_str() + 3);
+        else if (opt.compare(0, 6, "speed=") == 0) r.speedScale = (float)atof(opt.c_str() + 6);
+        else {
+            error = "unknown option '" + opt + "'";
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool parseText(const char* path, std::vector<Block>& blocks, std::string& error) {
+    std::ifstream file(path);
+    if (!file) {
+        error = std::string("cannot open ") + path;
+        return false;
+    }
+
+    double hpBase = 30, hpPerWave = 5, speedBase = 80, speedPerWave = 5;
+    std::string line;
+    for (int lineNo = 1; std::getline(file, line); ++lineNo) {
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+        std::istringstream in(line);
+        std::string word;
+        if (!(in >> word)) continue;
+
+        std::string where = std::string(path) + ":" + std::to_string(lineNo) + ": ";
+        if (word == "curve") {
+            std::string stat;
+            double base, perWave;
+            if (!(in >> stat >> base >> perWave) || (stat != "hp" && stat != "speed")) {
+                error = where + "expected 'curve hp|speed BASE PER_WAVE'";
+                return false;
+            }
+            (stat == "hp" ? hpBase : speedBase) = base;
+            (stat == "hp" ? hpPerWave : speedPerWave) = perWave;
+        } else if (word == "wave" || word == "waves") {
+            Block b;
+            if (!(in >> b.firstWave)) {
+                error = where + "expected a wave number";
+                return false;
+            }
+            b.lastWave = b.firstWave;
+            if (word == "waves" && !(in >> b.lastWave)) {
+                error = where + "expected 'waves FIRST LAST'";
+                return false;
+            }
+            int expected = blocks.empty() ? b.firstWave : blocks.back().lastWave + 1;
+            if (b.firstWave < 1 || b.lastWave < b.firstWave || b.firstWave != expected) {
+                error = where + "waves must be consecutive and ascending (expected " + std::to_string(expected) + ")";
+                return false;
+            }
+            b.hpBase = hpBase;
+            b.hpPerWave = hpPerWave;
+            b.speedBase = speedBase;
+            b.speedPerWave = speedPerWave;
+            blocks.push_back(b);
+        } else if (word == "spawn" || word == "stream") {
+            if (blocks.empty()) {
+                error = where + "spawn before any 'wave' line";
+                return false;
+            }
+            SpawnLine s;
+            s.stream = word == "stream";
+            s.start = 0.0f;
+            s.interval = 0.0f;
+            s.countBase = 1;
+            s.countPerWave = 0;
+            bool ok = s.stream ? (bool)(in >> s.start >> s.interval >> s.countBase >> s.countPerWave)
+                               : (bool)(in >> s.start);
+            if (!ok) {
+                error = where + (s.stream ? "expected 'stream START INTERVAL COUNT PER_WAVE ...'"
+                                          : "expected 'spawn TIME ...'");
+                return false;
+            }
+            // The count is linear in the wave, so the block's ends bound it
+            const Block& b = blocks.back();
+            for (int w : { b.firstWave, b.lastWave }) {
+                long long count = s.countBase + (long long)s.countPerWave * w;
+                if (count < 0 || count > INT_MAX) {
+                    error = where + "COUNT + PER_WAVE * wave is " + std::to_string(count) + " at wave " +
+                            std::to_string(w);
+                    return false;
+                }
+            }
+            std::string argError;
+            if (!parseSpawnArgs(in, s.record, argError)) {
+                error = where + argError;
+                return false;
+            }
+            s.record.time = s.start;
+            blocks.back().lines.push_back(s);
+        } else {
+            error = where + "unknown statement '" + word + "'";
+            return false;
+        }
+    }
+    if (blocks.empty()) {
+        error = std::string(path) + ": no waves defined";
+        return false;
+    }
+    return true;
+}
+
+// Expands the blocks into the binary image (curves and streams evaluated here,
+// once, so the game only reads numbers).
+static std::vector<unsigned char> buildImage(const std::vector<Block>& blocks) {
+    std::vector<WaveRecord> waves;
+    std::vector<SpawnRecord> spawns;
+    for (const Block& b : blocks) {
+        for (int w = b.firstWave; w <= b.lastWave; ++w) {
+            WaveRecord rec;
+            rec.firstSpawn = (uint32_t)spawns.size();
+            rec.hp = (int32_t)(b.hpBase + b.hpPerWave * w);
+            rec.speed = (float)(b.speedBase + b.speedPerWave * w);
+
+            std::vector<SpawnRecord> list;
+            for (const SpawnLine& s : b.lines) {
+                int count = s.stream ? s.countBase + s.countPerWave * w : 1;
+                for (int i = 0; i < count; ++i) {
+                    SpawnRecord r = s.record;
+                    r.time = s.start + i * s.interval;
+                    list.push_back(r);
+                }
+            }
+            std::stable_sort(list.begin(), list.end(),
+                             [](const SpawnRecord& a, const SpawnRecord& c) { return a.time < c.time; });
+            spawns.insert(spawns.end(), list.begin(), list.end());
+            rec.spawnCount = (uint32_t)list.size();
+            waves.push_back(rec);
+        }
+    }
+
+    WaveTableHeader header;
+    memcpy(header.magic, "WSWT", 4);
+    header.version = WaveTable::VERSION;
+    header.firstWave = (uint32_t)blocks.front().firstWave;
+    header.waveCount = (uint32_t)waves.size();
+    header.spawnCount = (uint32_t)spawns.size();
+    header.reserved = 0;
+
+    std::vector<unsigned char> image(sizeof(header) + waves.size() * sizeof(WaveRecord) +
+                                     spawns.size() * sizeof(SpawnRecord));
+    unsigned char* p = image.data();
+    memcpy(p, &header, sizeof(header));
+    p += sizeof(header);
+    if (!waves.empty()) memcpy(p, waves.data(), waves.size() * sizeof(WaveRecord));
+    p += waves.size() * sizeof(WaveRecord);
+    if (!spawns.empty()) memcpy(p, spawns.data(), spawns.size() * sizeof(SpawnRecord));
+    return image;
+}
+
+static int compile(const char* in, const char* out) {
+    std::vector<Block> blocks;
+    std::string error;
+    if (!parseText(in, blocks, error)) {
+        fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    std::vector<unsigned char> image = buildImage(blocks);
+    if (!WaveTable::validate(image.data(), image.size(), &error)) {
+        fprintf(stderr, "%s: %s\n", in, error.c_str());
+        return 1;
+    }
+
+    FILE* f = fopen(out, "wb");
+    if (!f || fwrite(image.data(), 1, image.size(), f) != image.size() || fclose(f) != 0) {
+        fprintf(stderr, "cannot write %s\n", out);
+        return 1;
+    }
+    const WaveTableHeader* h = reinterpret_cast<const WaveTableHeader*>(image.data());
+    printf("%s: waves %u-%u, %u spawns, %zu bytes\n", out, h->firstWave,
+           h->firstWave + h->waveCount - 1, h->spawnCount, image.size());
+    return 0;
+}
+
+static int validateFile(const char* path, bool dump) {
+    WaveTable table;
+    std::string error;
+    if (!table.open(path, &error)) {
+        fprintf(stderr, "%s: %s\n", path, error.c_str());
+        return 1;
+    }
+    printf("%s: ok, waves %u-%u, %u spawns\n", path, table.firstWave(),
+           table.firstWave() + table.waveCount() - 1, table.spawnCount());
+    if (!dump) return 0;
+
+    for (uint32_t i = 0; i < table.waveCount(); ++i) {
+        int number = (int)(table.firstWave() + i);
+        const WaveRecord& w = *table.wave(number);
+        printf("wave %d: hp %d, speed %.1f, %u spawns\n", number, w.hp, w.speed, w.spawnCount);
+        const SpawnRecord* s = table.spawnsOf(w);
+        for (uint32_t j = 0; j < w.spawnCount; ++j) {
+            char type[8], x[16];
+            if (s[j].flags & SpawnRecord::RANDOM_TYPE) strcpy(type, "random");
+            else snprintf(type, sizeof(type), "%d", s[j].type);
+            if (s[j].flags & SpawnRecord::RANDOM_X) strcpy(x, "random");
+            else snprintf(x, sizeof(x), "%g", s[j].xOffset);
+            printf("  %7.2f  type %-6s x %-6s pattern %d  hp x%g  speed x%g\n", s[j].time, type, x,
+                   s[j].pattern, s[j].hpScale, s[j].speedScale);
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc == 4 && strcmp(argv[1], "compile") == 0) return compile(argv[2], argv[3]);
+    if (argc == 3 && strcmp(argv[1], "validate") == 0) return validateFile(argv[2], false);
+    if (argc == 3 && strcmp(argv[1], "dump") == 0) return validateFile(argv[2], true);
+
+    printf("Usage: %s compile IN.txt OUT.wst | validate FILE.wst | dump FILE.wst\n", argv[0]);
+    return 1;
+}